@@ -39,7 +39,7 @@
 // this suppress creating the new objects again and again
 // (each thread has their own diff-vec)
 //vec< vec<var_t> > diff_( omp_get_max_threads() );
-vec<var_t> diff_(0);
+thread_local vec<var_t> diff_(0);
 
 
 size_t lineral::hash() const {
@@ -0,0 +1,57 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "lineral_store.hpp"
+
+
+lid_t lineral_store::intern(const lineral& l) {
+    const auto search = idx.find(l);
+    if(search != idx.end()) return (search->second << 1) | l.has_constant();
+    //store l without constant
+    const lid_t i = lits.size();
+    assert(i < (NO_LID >> 1));
+    const auto [it,_] = l.has_constant() ? idx.emplace( l.plus_one(), i ) : idx.emplace( l, i );
+    lits.push_back( &(it->first) );
+    return (i << 1) | l.has_constant();
+};
+
+lid_t lineral_store::sum(const lid_t id1, const lid_t id2) {
+    const lid_t cnst = (id1 ^ id2) & 1;
+    const lid_t i1 = std::min(id1 >> 1, id2 >> 1);
+    const lid_t i2 = std::max(id1 >> 1, id2 >> 1);
+    //trivial sums
+    if(i1 == i2) return LID_ZERO | cnst;
+    if(i1 == 0) return (i2 << 1) | cnst;
+    const uint64_t key = (((uint64_t) i1) << 32) | i2;
+    const auto search = sums.find(key);
+    if(search != sums.end()) return (search->second << 1) | cnst;
+    const lid_t s = intern( *lits[i1] + *lits[i2] );
+    sums.emplace(key, s >> 1);
+    return s | cnst;
+};
+
+void lineral_store::truncate(const lid_t sz) {
+    if(sz >= lits.size()) return;
+    assert(sz > 0);
+    while(lits.size() > sz) {
+        idx.erase( *lits.back() );
+        lits.pop_back();
+    }
+    sums.clear();
+};
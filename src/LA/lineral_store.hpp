@@ -0,0 +1,174 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <utility>
+
+#include "lineral.hpp"
+
+#include "../robin_hood-3.11.5/robin_hood.h"
+
+/**
+ * @brief id of an interned lineral; the lowest bit is its constant, the remaining bits the index of the lineral without constant
+ */
+typedef uint32_t lid_t;
+
+/**
+ * @brief lid_t of lineral 0; LID_ZERO|1 is the lid_t of lineral 1
+ */
+#define LID_ZERO ((lid_t) 0)
+
+/**
+ * @brief lid_t indicating that there is no lineral
+ */
+#define NO_LID ((lid_t) -1)
+
+/**
+ * @brief hash of a lineral that ignores its constant
+ */
+struct lineral_idxs_hash {
+  inline std::size_t operator()(const lineral& l) const noexcept { return robin_hood::hash_bytes(l.get_idxs_().data(), sizeof(var_t)*l.get_idxs_().size()); };
+};
+
+/**
+ * @brief equality of linerals up to their constants
+ */
+struct lineral_idxs_eq {
+  inline bool operator()(const lineral& l1, const lineral& l2) const noexcept { return l1.get_idxs_() == l2.get_idxs_(); };
+};
+
+/**
+ * @brief hash-consing store of linerals: each lineral is stored once (up to its constant) and referred to by a lid_t; sums of linerals are memoized
+ * @note lineral 0 is always stored and has index 0
+ */
+class lineral_store
+{
+  private:
+    /**
+     * @brief idx[l] is the index of the lineral l (without constant)
+     */
+    robin_hood::unordered_node_map<lineral, lid_t, lineral_idxs_hash, lineral_idxs_eq> idx;
+
+    /**
+     * @brief lits[i] points to the key of idx with index i; keys of node maps are never moved
+     */
+    vec<const lineral*> lits;
+
+    /**
+     * @brief memoized sums, maps pairs of indices (smaller one in the upper 32 bits) to the index of their sum
+     */
+    robin_hood::unordered_flat_map<uint64_t, lid_t> sums;
+
+    void link() noexcept {
+      lits.resize( idx.size() );
+      for(const auto& [l,i] : idx) lits[i] = &l;
+    };
+
+  public:
+    lineral_store() noexcept { intern( lineral() ); };
+
+    lineral_store(const lineral_store& o) noexcept : idx(o.idx), sums(o.sums) { link(); };
+
+    lineral_store(lineral_store&& o) noexcept : idx(std::move(o.idx)), lits(std::move(o.lits)), sums(std::move(o.sums)) {};
+
+    ~lineral_store() {};
+
+    /**
+     * @brief interns lineral l
+     * 
+     * @param l lineral
+     * @return lid_t id of l
+     */
+    lid_t intern(const lineral& l);
+
+    /**
+     * @brief looks up lineral l without interning it
+     * 
+     * @param l lineral
+     * @return lid_t id of l, NO_LID if l was never interned
+     */
+    inline lid_t find(const lineral& l) const {
+      const auto search = idx.find(l);
+      return search == idx.end() ? NO_LID : ((search->second << 1) | l.has_constant());
+    };
+
+    /**
+     * @brief retrieves lineral of id without constant
+     * 
+     * @param id id of lineral
+     * @return const lineral& lineral with index id>>1
+     */
+    inline const lineral& get_(const lid_t id) const noexcept { return *lits[id >> 1]; };
+
+    /**
+     * @brief retrieves lineral of id
+     * 
+     * @param id id of lineral
+     * @return lineral lineral with id
+     */
+    inline lineral get(const lid_t id) const {
+      if(!(id & 1)) return get_(id);
+      lineral l = get_(id);
+      l.add_one();
+      return l;
+    };
+
+    inline var_t LT(const lid_t id) const noexcept { return get_(id).LT(); };
+
+    /**
+     * @brief computes id of the sum of two interned linerals; sums are memoized
+     * 
+     * @param id1 id of first lineral
+     * @param id2 id of second lineral
+     * @return lid_t id of sum
+     */
+    lid_t sum(const lid_t id1, const lid_t id2);
+
+    /**
+     * @brief number of stored linerals
+     */
+    inline lid_t size() const noexcept { return lits.size(); };
+
+    /**
+     * @brief number of memoized sums
+     */
+    inline size_t num_sums() const noexcept { return sums.size(); };
+
+    /**
+     * @brief removes all linerals with index at least sz, i.e., the ones interned after the store had size sz; clears memoized sums if anything is removed
+     * 
+     * @param sz number of linerals to keep
+     */
+    void truncate(const lid_t sz);
+
+    lineral_store& operator =(const lineral_store& o) noexcept {
+      idx = o.idx;
+      sums = o.sums;
+      link();
+      return *this;
+    };
+
+    lineral_store& operator =(lineral_store&& o) noexcept {
+      idx = std::move(o.idx);
+      lits = std::move(o.lits);
+      sums = std::move(o.sums);
+      return *this;
+    };
+};
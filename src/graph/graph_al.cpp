@@ -20,18 +20,18 @@
 #include "graph_al.hpp"
 
 
-graph_al::graph_al(const vec< std::pair<var_t,var_t> >& E, const var_t no_v_) noexcept : no_v(no_v_), no_e(2*E.size()) {
+graph_al::graph_al(const vec< std::pair<vert_t,vert_t> >& E, const vert_t no_v_) noexcept : no_v(no_v_), no_e(2*E.size()) {
     init(E, no_v_);
 };
 
-void graph_al::init(const vec< std::pair<var_t,var_t> >& E, const var_t no_v_) noexcept {
+void graph_al::init(const vec< std::pair<vert_t,vert_t> >& E, const vert_t no_v_) noexcept {
     //init data structures!
     no_e = 0;
     no_v = no_v_;
 
     //active vertices
-    L = vec<var_t>(no_v);
-    IL = vec<var_t>(no_v);
+    L = vec<vert_t>(no_v);
+    IL = vec<vert_t>(no_v);
 
     //adjacency list
     AL_out = vec<adj_l>(no_v);
@@ -40,8 +40,8 @@ void graph_al::init(const vec< std::pair<var_t,var_t> >& E, const var_t no_v_) n
 
     //fill AL_out
     for (const auto &e : E) {
-        const var_t src  = e.first;
-        const var_t dst = e.second;
+        const vert_t src  = e.first;
+        const vert_t dst = e.second;
         //add edge
         //AL_out[src].push_back(dst);
         const auto [_,inserted] = AL_out[src].insert(dst);
@@ -57,7 +57,7 @@ void graph_al::init(const vec< std::pair<var_t,var_t> >& E, const var_t no_v_) n
     }
 
     //init L, IL, CAL
-    for (var_t v = 0; v < no_v; ++v) {
+    for (vert_t v = 0; v < no_v; ++v) {
         //fill L and IL
         L[v] = v;
         IL[v] = v;
@@ -76,7 +76,7 @@ void graph_al::backtrack(graph_al_repr&& graph_orig) noexcept { //TODO use move-
 
 
 //removes idx-th going out from src as listed in AL_out_logical(src,idx) (ignores same-colored verts!)
-void graph_al::remove_edge(const var_t src, const var_t dst) noexcept {
+void graph_al::remove_edge(const vert_t src, const vert_t dst) noexcept {
     [[maybe_unused]] auto el_er = AL_out[src].erase( dst );
     assert( el_er == 1 );
     no_e--;
@@ -88,7 +88,7 @@ void graph_al::remove_edge(const var_t src, const var_t dst) noexcept {
 };
 
 //removes all out-going edges of src
-void graph_al::remove_all_edges(const var_t v) noexcept {
+void graph_al::remove_all_edges(const vert_t v) noexcept {
     //remove all symmetric edges
     for(const auto& dst : AL_out[v]) {
         if(SIGMA(dst)!=v) {
@@ -102,10 +102,10 @@ void graph_al::remove_all_edges(const var_t v) noexcept {
 };
 
 //remove color/vert c and SIGMA(c)
-void graph_al::remove_vert(const var_t c) noexcept {
+void graph_al::remove_vert(const vert_t c) noexcept {
     //std::cout << "no_v = " << std::to_string(no_v) << "; removing " << std::to_string(c) << " (" << std::to_string(SIGMA(c)) << ")" << std::endl;
     //remove c and SIGMA(c)
-    for (const auto &v : std::vector<var_t>({c,SIGMA(c)})) {
+    for (const auto &v : std::vector<vert_t>({c,SIGMA(c)})) {
         --no_v;
         //swap vertices in L and fix IL, move v 'out-of-scope'
         std::swap( L[ IL[v] ], L[ no_v ] );
@@ -117,7 +117,7 @@ void graph_al::remove_vert(const var_t c) noexcept {
 };
 
 //merges colors v1 and v2, color of v2 will be set to color of v1; and color of SIGMA(v2) set to color of SIGMA(v1)
-void graph_al::merge_verts(const var_t v1, const var_t v2) noexcept {
+void graph_al::merge_verts(const vert_t v1, const vert_t v2) noexcept {
     //std::cout << "no_v = " << std::to_string(no_v) << "; merging " << std::to_string(VC[v1]) << " and " << std::to_string(VC[v2]) << " (" << std::to_string(VC[SIGMA(v1)]) << " and " << std::to_string(VC[SIGMA(v2)]) << ")" << std::endl;
     //abort if 
     if(v1==v2 || IL[v1] >= no_v || IL[v2] >= no_v) return;
@@ -145,14 +145,14 @@ void graph_al::merge_verts(const var_t v1, const var_t v2) noexcept {
     }
 
     //'bend' all incoming edges of v2 to go to v1 instead!
-    for(const var_t v : get_in_neighbour_vector(v2)) { //cannot use range, as lazy eval produce bugs as to AL_out[SIGMA(v2)] being updated!
+    for(const vert_t v : get_in_neighbour_vector(v2)) { //cannot use range, as lazy eval produce bugs as to AL_out[SIGMA(v2)] being updated!
         AL_out[v].erase(v2);
         const auto ins = AL_out[v].insert(v1);
         if(!ins.second) no_e--;
     }
     if(SIGMA(v2) != v1) {
         //'bend' all incoming edges of SIGMA(v2) to go to SIGMA(v1)!
-        for(const var_t v : get_in_neighbour_vector(SIGMA(v2))) { //cannot use range, as lazy eval produce bugs as to AL_out[v2] being updated!
+        for(const vert_t v : get_in_neighbour_vector(SIGMA(v2))) { //cannot use range, as lazy eval produce bugs as to AL_out[v2] being updated!
             AL_out[v].erase(SIGMA(v2));
             const auto ins = AL_out[v].insert(SIGMA(v1));
             if(!ins.second) no_e--;
@@ -179,21 +179,21 @@ void graph_al::merge_verts(const var_t v1, const var_t v2) noexcept {
 };
 
 bool graph_al::assert_data_structs() const noexcept {
-    assert(no_e <= no_v*no_v);
-    var_t total_d_out = 0;
-    for (var_t u = 0; u < no_v; ++u) {
+    assert((uint64_t) no_e <= (uint64_t) no_v*no_v);
+    edge_cnt_t total_d_out = 0;
+    for (vert_t u = 0; u < no_v; ++u) {
         total_d_out += AL_out[L[u]].size();
         for([[maybe_unused]] const auto dst : AL_out[L[u]]) assert(IL[dst] < no_v);
     };
     assert(total_d_out == no_e);
 
     //check sigma
-    for (var_t u = 0; u < L.size(); ++u) {
+    for (vert_t u = 0; u < L.size(); ++u) {
         assert(SIGMA(SIGMA(u)) == u);
     };
 
     //check that L and IL match!
-    for (var_t u = 0; u < L.size(); ++u) {
+    for (vert_t u = 0; u < L.size(); ++u) {
         assert( L[ IL[u] ] == u && IL[ L[u] ] == u );
     }
 
@@ -201,16 +201,16 @@ bool graph_al::assert_data_structs() const noexcept {
 };
 
 std::string graph_al::to_str() const noexcept {
-    std::map<var_t, vec<var_t> > edges;
-    for (var_t c_idx = 0; c_idx < no_v; ++c_idx) {
+    std::map<vert_t, vec<vert_t> > edges;
+    for (vert_t c_idx = 0; c_idx < no_v; ++c_idx) {
         //get color at c_idx
-        const var_t c = L[c_idx];
+        const vert_t c = L[c_idx];
         //add all out-neighbors to edges[c_idx]
         edges[c] = get_out_neighbour_vector( c );
         //iterate over all verts of color c
         //for (auto &&v : CAL[c]) {
         //    //add out-neighbors of v to edges[c_idx]
-        //    for (var_t i = 0; i < VD_out[v]; ++i) {
+        //    for (vert_t i = 0; i < VD_out[v]; ++i) {
         //        edges[ c ].push_back( VC[ AL_out[v][i] ] );
         //    }
         //}
@@ -220,11 +220,11 @@ std::string graph_al::to_str() const noexcept {
 
     //generate string of edges with lexicographic ordering!
     vec< std::string > str_edges(0);
-    for( std::map<var_t, vec<var_t>>::iterator iter = edges.begin(); iter != edges.end(); ++iter ) {
+    for( std::map<vert_t, vec<vert_t>>::iterator iter = edges.begin(); iter != edges.end(); ++iter ) {
         vec<std::string> out_edges_str( iter->second.size() );
         //construct strings!
-        const var_t src = iter->first;
-        auto to_str = [src](const var_t dst) -> std::string {return "("+std::to_string(src)+","+std::to_string(dst)+")";};
+        const vert_t src = iter->first;
+        auto to_str = [src](const vert_t dst) -> std::string {return "("+std::to_string(src)+","+std::to_string(dst)+")";};
         std::transform(iter->second.begin(), iter->second.end(), out_edges_str.begin(), to_str);
 
         std::stringstream ss;
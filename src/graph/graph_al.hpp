@@ -35,8 +35,8 @@
 //#include <unordered_set>
 
 //type of 'adjacency_list'
-typedef std::set<var_t> adj_l;
-//typedef std::unordered_set<var_t> adj_l; //SIGNIFICANTLY SLOWER!
+typedef std::set<vert_t> adj_l;
+//typedef std::unordered_set<vert_t> adj_l; //SIGNIFICANTLY SLOWER!
 
 /**
  *  @brief implementation of skew-symmetric graph representation
@@ -46,15 +46,15 @@ typedef std::set<var_t> adj_l;
 class graph_al_repr {
   public:
     //number of active vertices
-    var_t no_v;
+    vert_t no_v;
     //number of active edges
-    var_t no_e;
+    edge_cnt_t no_e;
 
     //adjacency list
     vec<adj_l> AL_out;
 
     //ctor for graph_al_repr
-    graph_al_repr(const var_t _no_v, const var_t _no_e, const vec<adj_l>& _AL_out) noexcept : no_v(_no_v), no_e(_no_e), AL_out(_AL_out) {};
+    graph_al_repr(const vert_t _no_v, const edge_cnt_t _no_e, const vec<adj_l>& _AL_out) noexcept : no_v(_no_v), no_e(_no_e), AL_out(_AL_out) {};
     graph_al_repr(const graph_al_repr& o) noexcept : no_v(o.no_v), no_e(o.no_e), AL_out(o.AL_out) {};
     graph_al_repr(graph_al_repr&& o) noexcept : no_v(std::move(o.no_v)), no_e(std::move(o.no_e)), AL_out(std::move(o.AL_out)) {};
     ~graph_al_repr() = default;
@@ -70,24 +70,24 @@ class graph_al {
     /* 
      *  number of (active) vertices
      */
-    var_t no_v;
+    vert_t no_v;
 
     /* 
      *  number of edges
      */
-    var_t no_e;
+    edge_cnt_t no_e;
 
     /*
      *  L list of vertices
      *  O( no_v )
      */
-    vec<var_t> L;
+    vec<vert_t> L;
 
     /*
      *  IL - index of vertex in L
      *  O( no_v )
      */ 
-    vec<var_t> IL;
+    vec<vert_t> IL;
 
     /*
      *  AL - adjacency list
@@ -100,7 +100,7 @@ class graph_al {
      * 
      * @note this allows us to only store out-going edges for each node, as AL_in[v] = sigma( AL_out[ sigma(v) ] )
      */
-    //vec<var_t> sigma;
+    //vec<vert_t> sigma;
 
   public:
     /**
@@ -112,9 +112,9 @@ class graph_al {
      *  @param E     vector of vector of idx of edges, i.e., we have edge (u,v) iff v is in E[u],
      *               note that the vertices have to be in {0,..,no_v_-1} and there should be EXACTLY no_e_ edges in total.
      */ 
-    graph_al(const vec< std::pair<var_t,var_t> >& E, const var_t no_v) noexcept;
+    graph_al(const vec< std::pair<vert_t,vert_t> >& E, const vert_t no_v) noexcept;
 
-    graph_al(const graph_al& g) noexcept : no_v(g.no_v), no_e(g.no_e), L(g.L), IL(g.L), AL_out(g.AL_out) {};
+    graph_al(const graph_al& g) noexcept : no_v(g.no_v), no_e(g.no_e), L(g.L), IL(g.IL), AL_out(g.AL_out) {};
 
     graph_al() = default;
 
@@ -129,22 +129,46 @@ class graph_al {
      *  @param E     vector of vector of idx of edges, i.e., we have edge (u,v) iff v is in E[u],
      *               note that the vertices have to be in {0,..,no_v_-1} and there should be EXACTLY no_e_ edges in total.
      */ 
-    void init(const vec< std::pair<var_t,var_t> >& E, const var_t no_v_) noexcept;
+    void init(const vec< std::pair<vert_t,vert_t> >& E, const vert_t no_v_) noexcept;
 
 
     /**
      * @brief Get number of (active) verts of graph
      * 
-     * @return var_t number of verts
+     * @return vert_t number of verts
      */
-    inline var_t get_no_v() const noexcept { return no_v; };
+    inline vert_t get_no_v() const noexcept { return no_v; };
 
     /**
      * @brief Get number of (active) edges of graph
      * 
-     * @return var_t number of edges
+     * @return edge_cnt_t number of edges
      */
-    inline var_t get_no_e() const noexcept { return no_e; };
+    inline edge_cnt_t get_no_e() const noexcept { return no_e; };
+
+    /**
+     * @brief Get total number of verts, i.e., active and inactive ones; all verts are in {0,...,get_no_v_total()-1}
+     * 
+     * @return vert_t number of verts
+     */
+    inline vert_t get_no_v_total() const noexcept { return L.size(); };
+
+    /**
+     * @brief checks whether v is an active vert, i.e., it was neither removed nor merged into another vert
+     * 
+     * @param v vert
+     * @return true iff v is active
+     */
+    inline bool is_active(const vert_t v) const noexcept { return IL[v] < no_v; };
+
+    /**
+     * @brief Get color of v, i.e., the active vert that represents v
+     * 
+     * @param v vert
+     * @return vert_t color of v
+     * @note graph_al does not keep track of merged verts, i.e., v must be active
+     */
+    inline vert_t get_color(const vert_t v) const noexcept { return v; };
 
     /**
      * @brief Get range over all active verts
@@ -160,8 +184,8 @@ class graph_al {
      * 
      * @return vector of out-neighbours
      */
-    vec<var_t> get_v_vector() const noexcept {
-      vec<var_t> vs(no_v);
+    vec<vert_t> get_v_vector() const noexcept {
+      vec<vert_t> vs(no_v);
       std::copy(L.begin(), L.begin()+no_v, vs.begin());
       return vs;
     }
@@ -186,14 +210,27 @@ class graph_al {
      *  @param src source vertex
      *  @param dst dst vertex
      */
-    void remove_edge(const var_t src, const var_t dst) noexcept;
+    void remove_edge(const vert_t src, const vert_t dst) noexcept;
+
+    /**
+     *  @brief removes the edge src->dst and its symmetrical counterpart, if present
+     * 
+     *  @param src source vertex
+     *  @param dst dst vertex
+     *  @return true iff the edge was present, i.e., it was removed
+     */
+    inline bool erase_edge(const vert_t src, const vert_t dst) noexcept {
+      if(!AL_out[src].contains(dst)) return false;
+      remove_edge(src, dst);
+      return true;
+    };
 
     /**
      *  @brief removes all out-going and incoming edges of v (faster than removing the edges one-by-one) and their symmetrical counterparts
      * 
      *  @param v v vertex
      */
-    void remove_all_edges(const var_t v) noexcept;
+    void remove_all_edges(const vert_t v) noexcept;
 
     /**
      *  @brief removes vertex v and its symmetric counterpart from the graph
@@ -202,7 +239,7 @@ class graph_al {
      *  @note also removes all outgoing edges
      *  @note implementation is in O( CD_out[v]+CD_out[sigma(v)] )
      */
-    void remove_vert(const var_t v) noexcept;
+    void remove_vert(const vert_t v) noexcept;
 
     /**
      * @brief merges vertices v1 and v2, color of v2 will be set to color of v1 (also merges the symmetric counterparts!)
@@ -210,7 +247,17 @@ class graph_al {
      * @param v1 vertex to merge with
      * @param v2 vertex to be merged with
      */
-    void merge_verts(const var_t v1, const var_t v2) noexcept;
+    void merge_verts(const vert_t v1, const vert_t v2) noexcept;
+
+    /**
+     * @brief merges v2 into v1 for every pair (v1,v2) in merge_list (in the given order), and their symmetric counterparts
+     * 
+     * @param merge_list pairs of verts to be merged
+     * @note as AL_out consists of sets, merge_verts never rescans edges, i.e., the pairs are simply merged one after another
+     */
+    inline void merge_verts(const vec< std::pair<vert_t,vert_t> >& merge_list) noexcept {
+      for(const auto& [v1,v2] : merge_list) merge_verts(v1, v2);
+    };
 
     /**
      * @brief get out-degree of vertex (i.e. degree of its color!)
@@ -218,7 +265,7 @@ class graph_al {
      * @param v vertex (color)
      * @return out-degree of vert (color)
      */
-    inline var_t get_out_degree(const var_t v) const noexcept { return AL_out[ v ].size(); };
+    inline vert_t get_out_degree(const vert_t v) const noexcept { return AL_out[ v ].size(); };
 
     /**
      * @brief Get range over out-neighbours of v 
@@ -226,7 +273,7 @@ class graph_al {
      * @param v vertex v
      * @return range over out-neighbors
      */
-    inline auto get_out_neighbour_range(const var_t v) const noexcept {
+    inline auto get_out_neighbour_range(const vert_t v) const noexcept {
       return AL_out[v];
     };
 
@@ -236,9 +283,9 @@ class graph_al {
      * @param v vertex v
      * @return vector of out-neighbours
      */
-    vec<var_t> get_out_neighbour_vector(const var_t v) const noexcept {
+    vec<vert_t> get_out_neighbour_vector(const vert_t v) const noexcept {
       auto r = get_out_neighbour_range(v);
-      vec<var_t> out_n;
+      vec<vert_t> out_n;
       std::ranges::copy(r, std::back_inserter(out_n));
       return out_n;
     }
@@ -249,7 +296,7 @@ class graph_al {
      * @param v vertex (color)
      * @return in-degree of vert (color)
      */
-    inline var_t get_in_degree(const var_t v) const noexcept { return AL_out[ SIGMA(v) ].size(); };
+    inline vert_t get_in_degree(const vert_t v) const noexcept { return AL_out[ SIGMA(v) ].size(); };
 
     /**
      * @brief Get range over in-neighbours of v 
@@ -257,7 +304,7 @@ class graph_al {
      * @param v vertex v
      * @return range over in-neighbors
      */
-    inline auto get_in_neighbour_range(const var_t v) const noexcept {
+    inline auto get_in_neighbour_range(const vert_t v) const noexcept {
       return AL_out[SIGMA(v)] | std::views::transform(
                                  [this](const auto& w)
                                  { return SIGMA(w); }
@@ -270,9 +317,9 @@ class graph_al {
      * @param v vertex v
      * @return vector of in-neighbours
      */
-    vec<var_t> get_in_neighbour_vector(const var_t v) const noexcept {
+    vec<vert_t> get_in_neighbour_vector(const vert_t v) const noexcept {
       auto r = get_in_neighbour_range(v);
-      vec<var_t> in_n;
+      vec<vert_t> in_n;
       std::ranges::copy(r, std::back_inserter(in_n));
       return in_n;
     }
@@ -19,102 +19,195 @@
 
 #include "graph_lhgr.hpp"
 
-graph_lhgr::graph_lhgr(const vec< std::pair<var_t,var_t> >& E, const var_t no_v_) noexcept : no_v(no_v_), no_e(2*E.size()) {
+graph_lhgr::graph_lhgr(const vec< std::pair<vert_t,vert_t> >& E, const vert_t no_v_) noexcept : no_v(no_v_), no_e(2*E.size()) {
     init(E,no_v_);
 };
 
-void graph_lhgr::init(const vec< std::pair<var_t,var_t> >& E, const var_t no_v_) noexcept {
+void graph_lhgr::init(const vec< std::pair<vert_t,vert_t> >& E, const vert_t no_v_) noexcept {
     //init data structures!
     no_e = 0;
     no_v = no_v_;
 
     //active vertices
-    L = vec<var_t>(no_v);
-    IL = vec<var_t>(no_v);
-
-    //adjacency list
-    AL_out = vec< vec<var_t> >(no_v);
-    IAL_in = vec< vec<var_t> >(no_v);
+    L = vec<vert_t>(no_v);
+    IL = vec<vert_t>(no_v);
+
+    //adjacency list -- allocate exactly the space required by E for every pair of symmetric verts
+    AL_size = vec<vert_t>(no_v + (no_v & 1), 0);
+    for (const auto &[src, dst] : E) {
+        ++AL_size[src];
+        if(SIGMA(dst) != src) ++AL_size[SIGMA(dst)];
+    }
+    AL = vec< vec<vert_t> >(AL_size.size()/2);
+    for (vert_t x = 0; x < AL.size(); ++x) {
+        if(AL_size[2*x] + AL_size[2*x+1] > 0) AL[x] = vec<vert_t>( 2*(AL_size[2*x] + AL_size[2*x+1]) );
+    }
+    std::fill(AL_size.begin(), AL_size.end(), 0);
 
     //degree
-    VD_out = vec<var_t>(no_v, 0);
+    VD_out = vec<vert_t>(no_v, 0);
+
+    //trail of inserted edges
+    ins_trail.clear();
 
     //color
-    CAL = vec< std::list<var_t> >(no_v);
+    CAL = vec< std::list<vert_t> >(no_v);
     
-    VC = vec<var_t>(no_v);
-    CD_out = vec<var_t>(no_v);
+    VC = vec<vert_t>(no_v);
+    CD_out = vec<vert_t>(no_v);
 
     //fill data structures:
 
     //fill AL_out
     for (const auto &e : E) {
-        const var_t src  = e.first;
-        const var_t dst = e.second;
-        add_edge(src,dst);
+        const vert_t src  = e.first;
+        const vert_t dst = e.second;
+        append_edge_(src,dst);
     }
 
     //init L, IL, CAL
-    for (var_t v = 0; v < no_v; ++v) {
+    for (vert_t v = 0; v < no_v; ++v) {
         //fill L and IL
         L[v] = v;
         IL[v] = v;
         
         //fill CAL
-        CAL[v] = std::list<var_t>(1, v);
+        CAL[v] = std::list<vert_t>(1, v);
         
         //init VC
         VC[v] = v; //every node has their own color
 
         //init VD_out, VD_in, CD_out, CD_in
+        VD_out[v] = AL_size[v];
         CD_out[v] = VD_out[v];
         no_e += VD_out[v];
     }
+    VD_out_pg.init(VD_out);
+    VC_pg.init(VC);
 
     assert( graph_lhgr::assert_data_structs() );
 };
 
 
-void graph_lhgr::add_edge(const var_t src, const var_t dst) noexcept {
+void graph_lhgr::push_edge_(const vert_t v, const vert_t dst, const vert_t mir) noexcept {
+    const vert_t x = v>>1;
+    const size_t cap = al_cap_(v);
+    if(AL_size[2*x] + AL_size[2*x+1] == cap) {
+        //double capacity; out-edges of 2*x stay at the front, out-edges of 2*x+1 at the back of each half
+        const size_t cap_ = std::max((size_t) 2, 2*cap);
+        const vert_t d_e = AL_size[2*x];
+        const vert_t d_o = AL_size[2*x+1];
+        vec<vert_t> A( 2*cap_ );
+        std::copy(AL[x].begin(), AL[x].begin() + d_e, A.begin());
+        std::copy(AL[x].begin() + cap, AL[x].begin() + cap + d_e, A.begin() + cap_);
+        std::copy(AL[x].begin() + cap - d_o, AL[x].begin() + cap, A.begin() + cap_ - d_o);
+        std::copy(AL[x].end() - d_o, AL[x].end(), A.end() - d_o);
+        AL[x] = std::move(A);
+    }
+    ++AL_size[v];
+    AL_out_(v, AL_size[v]-1) = dst;
+    IAL_in_(v, AL_size[v]-1) = mir;
+};
+
+void graph_lhgr::append_edge_(const vert_t src, const vert_t dst) noexcept {
     assert(src != dst);
-    assert(src < no_v);
-    assert(dst < no_v);
-    //add edge
-    AL_out[src].push_back(dst);
-    ++VD_out[src];
-    //set IAL_in
-    const var_t i = AL_out[src].size()-1; //idx of dst in src
+    assert(src < AL_size.size());
+    assert(dst < AL_size.size());
+    const vert_t i = AL_size[src]; //idx of dst in src
 
     //add symmetric edge sigma(dst)->sigma(src) --- if distinct!
-    var_t j = i;
+    vert_t j = i;
     if(SIGMA(dst) != src) {
-        AL_out[ SIGMA(dst) ].push_back( SIGMA(src) );
-        ++VD_out[ SIGMA(dst) ];
-        //set IAL_in
-        j = AL_out[SIGMA(dst)].size()-1; //idx of sigma(src) in AL_out[ sigma(dst) ]
+        j = AL_size[SIGMA(dst)]; //idx of sigma(src) in AL_out[ sigma(dst) ]
+        push_edge_(SIGMA(dst), SIGMA(src), i);
     }
-    
-    //store in IAL_in -- resize vector if necessary!
-    if(i >= IAL_in[src].size()) IAL_in[src].resize(i+1);
-    IAL_in[src][i] = j;
+    //add edge
+    push_edge_(src, dst, j);
+    assert( AL_out_(SIGMA(AL_out_(src, i)), IAL_in_(src, i)) == SIGMA(src) );
+    assert( AL_out_(SIGMA(AL_out_(SIGMA(dst), j)), IAL_in_(SIGMA(dst), j)) == SIGMA(SIGMA(dst)) );
+};
+
+void graph_lhgr::swap_edges_(const vert_t src, const vert_t i, const vert_t j) noexcept {
+    if(i == j) return;
+    const vert_t a = AL_out_(src, i);
+    const vert_t b = AL_out_(src, j);
+    //positions of symmetric edges after the swap (they might be the swapped edges themselves!)
+    auto new_idx = [&](const vert_t w, const vert_t k) -> vert_t { return w != src ? k : (k == i ? j : (k == j ? i : k)); };
+    const vert_t ia = new_idx(SIGMA(a), IAL_in_(src, i));
+    const vert_t ib = new_idx(SIGMA(b), IAL_in_(src, j));
+
+    std::swap( AL_out_(src, i), AL_out_(src, j) );
+    IAL_in_(src, j) = ia;
+    IAL_in_(src, i) = ib;
+    IAL_in_(SIGMA(a), ia) = j;
+    IAL_in_(SIGMA(b), ib) = i;
+};
+
+bool graph_lhgr::add_edge(const vert_t src_, const vert_t dst) noexcept {
+    assert(IL[VC[src_]] < no_v);
+    assert(IL[VC[dst]] < no_v);
+    assert(VC[src_] != VC[dst]);
+    //if the edge is self-symmetric on colors, use sigma(dst) as source; then only one edge is inserted
+    const vert_t src = (VC[SIGMA(dst)] == VC[src_]) ? SIGMA(dst) : src_;
+    //skip edges that are already present
+    for(const auto c : get_out_neighbour_range(src)) {
+        if(c == VC[dst]) return false;
+    }
+
+    ins_trail.push_back( {src, dst, VD_out[src], VD_out[SIGMA(dst)]} );
+    append_edge_(src, dst);
+    //move new edges to the first out-of-scope position and put them in-scope; older states are restored by undo_insertion_
+    swap_edges_(src, VD_out[src], AL_size[src]-1);
+    VD_out_pg.touch(src);
+    ++VD_out[src];
+    ++CD_out[ VC[src] ];
+    ++no_e;
     if(SIGMA(dst) != src) {
-        //store in IAL_in -- resize vector if necessary!
-        if(j >= IAL_in[SIGMA(dst)].size()) IAL_in[SIGMA(dst)].resize(j+1);
-        IAL_in[SIGMA(dst)][j] = i;
+        swap_edges_(SIGMA(dst), VD_out[SIGMA(dst)], AL_size[SIGMA(dst)]-1);
+        VD_out_pg.touch(SIGMA(dst));
+        ++VD_out[SIGMA(dst)];
+        ++CD_out[ VC[SIGMA(dst)] ];
+        ++no_e;
+    }
+    assert( graph_lhgr::assert_data_structs() );
+    return true;
+};
+
+void graph_lhgr::undo_insertion_() noexcept {
+    const auto [src, dst, p, p_] = ins_trail.back();
+    ins_trail.pop_back();
+    const vert_t src_ = SIGMA(dst);
+
+    //since insertion AL_out[src] was only permuted in its first p+1 entries; find (a copy of) the inserted edge there
+    vert_t x = p;
+    while( AL_out_(src, x) != dst || (src_ != src && IAL_in_(src, x) > p_) ) {
+        assert(x > 0);
+        --x;
+    }
+    //move edge back to its insertion position, then to the end of AL_out[src], i.e., the position it was appended to
+    swap_edges_(src, x, p);
+    swap_edges_(src, p, AL_size[src]-1);
+    if(src_ != src) {
+        swap_edges_(src_, IAL_in_(src, AL_size[src]-1), p_);
+        swap_edges_(src_, p_, AL_size[src_]-1);
+        --AL_size[src_];
     }
-    assert( AL_out[ SIGMA(AL_out[src][i]) ][IAL_in[src][i]] == SIGMA(src) );
-    assert( AL_out[ SIGMA(AL_out[SIGMA(dst)][j]) ][IAL_in[SIGMA(dst)][j]] == SIGMA(SIGMA(dst)) );
+    --AL_size[src];
 };
 
 void graph_lhgr::backtrack(graph_lhgr_repr&& graph_orig) noexcept {
+    //undo edge insertions that happened after graph_orig was stored (before VD_out is restored!)
+    while(ins_trail.size() > graph_orig.no_ins) undo_insertion_();
+
     //restore graph_lhgr from graph_lhgr_lhgr_repr  
     no_v = std::move(graph_orig.no_v);
     no_e = std::move(graph_orig.no_e);
-    VD_out = std::move(graph_orig.VD_out);
-    VC = std::move(graph_orig.VC);
+    //copy back the pages that differ from the stored ones
+    VD_out_pg.restore(VD_out, std::move(graph_orig.VD_out));
+    VC_pg.restore(VC, std::move(graph_orig.VC));
 
     //rebuild CAL and CD_out
-    for (var_t c_idx = 0; c_idx < no_v; ++c_idx) {
+    for (vert_t c_idx = 0; c_idx < no_v; ++c_idx) {
         //reset color lists in CAL
         CAL[L[c_idx]].clear();
 
@@ -123,14 +216,14 @@ void graph_lhgr::backtrack(graph_lhgr_repr&& graph_orig) noexcept {
     }
 
     //apply known colors to construct CAL and generate CD_out
-    for (var_t v = 0; v < VC.size(); ++v) {
+    for (vert_t v = 0; v < VC.size(); ++v) {
         CAL[ VC[v] ].push_back(v);
         CD_out[ VC[v] ] += VD_out[v];
     }
 };
 
 //remove single edge src->AL_out[src][idx] (does not touch its symmetric edge!)
-void graph_lhgr::remove_edge_(const var_t src, const var_t idx) noexcept {
+void graph_lhgr::remove_edge_(const vert_t src, const vert_t idx) noexcept {
     //do nothing if edge is already out-of-scope (might be relevant when this func is called from remove_all_edges where symmetrical edges are processed)
     if(idx >= VD_out[src]) return;
 
@@ -138,55 +231,74 @@ void graph_lhgr::remove_edge_(const var_t src, const var_t idx) noexcept {
     //decrease color-degree of colors of src and dst
     --CD_out[VC[src]];
     //decrease degree of src and dst
+    VD_out_pg.touch(src);
     --VD_out[src];
     
-    const var_t dst =  AL_out[src][idx];
+    const vert_t dst =  AL_out_(src, idx);
     //new position in AL_out_logical[src]
-    const var_t idx_ = VD_out[src];
-    const var_t dst_ = AL_out[src][idx_];
+    const vert_t idx_ = VD_out[src];
+    const vert_t dst_ = AL_out_(src, idx_);
     
     //decrease number of edges
     --no_e;
     
     //move dst out-of-range in AL_out[src]
-    std::swap( AL_out[src][idx], AL_out[src][idx_] );
+    std::swap( AL_out_(src, idx), AL_out_(src, idx_) );
     //adapt IAL_in
-    std::swap( IAL_in[ SIGMA(dst_) ][ IAL_in[src][idx_] ], IAL_in[ SIGMA(dst) ][ IAL_in[src][idx] ] );
+    std::swap( IAL_in_(SIGMA(dst_), IAL_in_(src, idx_)), IAL_in_(SIGMA(dst), IAL_in_(src, idx)) );
     //could do without local var dst_ -- but probably compiler optimizes that away anyways...
-    //std::swap( IAL_in[ SIGMA(AL_out[src][idx]) ][ IAL_in[src][idx_] ], IAL_in[ SIGMA(dst) ][ IAL_in[src][idx] ] );
-    std::swap( IAL_in[src][idx], IAL_in[src][idx_] );
+    //std::swap( IAL_in_(SIGMA(AL_out_(src, idx)), IAL_in_(src, idx_)), IAL_in_(SIGMA(dst), IAL_in_(src, idx)) );
+    std::swap( IAL_in_(src, idx), IAL_in_(src, idx_) );
 }
 
 //removes idx-th going out from src as listed in AL_out_logical(src,idx) (ignores same-colored verts!)
-void graph_lhgr::remove_edge(const var_t src, const var_t idx) noexcept {
+void graph_lhgr::remove_edge(const vert_t src, const vert_t idx) noexcept {
     //remove src -> AL_out[src,idx]
     remove_edge_(src, idx);
     //remove sigma(AL_out[src,idx]) -> IAL_out
-    remove_edge_(SIGMA(AL_out[src][VD_out[src]]), IAL_in[src][VD_out[src]]);
+    remove_edge_(SIGMA(AL_out_(src, VD_out[src])), IAL_in_(src, VD_out[src]));
+};
+
+//removes the edge VC[src] -> VC[dst] (there is at most one, as merge_verts removes duplicates)
+bool graph_lhgr::erase_edge(const vert_t src, const vert_t dst) noexcept {
+    for (const auto &w : CAL[VC[src]]) {
+        for (vert_t idx = 0; idx < VD_out[w]; ++idx) {
+            if( VC[AL_out_(w, idx)] != VC[dst] ) continue;
+            //remove only one of the edges if it is self-symmetric (cf. merge_verts)
+            if( VC[w] != VC[ SIGMA(AL_out_(w, idx)) ] ) {
+                remove_edge(w, idx);
+            } else {
+                remove_edge_(w, idx);
+            }
+            return true;
+        }
+    }
+    return false;
 };
 
 //removes all out-going edges of src
-void graph_lhgr::remove_all_edges(const var_t v) noexcept {
+void graph_lhgr::remove_all_edges(const vert_t v) noexcept {
     //loop over verts of same color and remove all of their out-edges
     for (const auto &src : CAL[VC[v]]) {
         //for every out-going edge (src,dst) in E, remove (src,dst) and (sigma(dst)(src));
-        for (var_t idx = 0; idx < VD_out[src]; ++idx) {
+        for (vert_t idx = 0; idx < VD_out[src]; ++idx) {
             //remove edge sigma(dst)->sigma(scr) -- if is NOT not self-symmetric (i.e. an out-going edge itself)
-            if( SIGMA(AL_out[src][idx]) != src ) remove_edge_(SIGMA(AL_out[src][idx]), IAL_in[src][idx]);
+            if( SIGMA(AL_out_(src, idx)) != src ) remove_edge_(SIGMA(AL_out_(src, idx)), IAL_in_(src, idx));
         };
     
         //remove all out-edges of src setting the degree to 0. (symmetric edges untouched!)
         CD_out[ VC[src] ] -= VD_out[src];
         no_e -= VD_out[src];
+        VD_out_pg.touch(src);
         VD_out[src] = 0;
     };
 };
 
 //remove color/vert c and SIGMA(c)
-void graph_lhgr::remove_vert(const var_t c) noexcept {
+void graph_lhgr::remove_vert(const vert_t c) noexcept {
     //std::cout << "no_v = " << std::to_string(no_v) << "; removing " << std::to_string(c) << " (" << std::to_string(SIGMA(c)) << ")" << std::endl;
     //remove c and SIGMA(c)
-    for (const auto &v : std::vector<var_t>({c, SIGMA(c)})) {
+    for (const auto &v : std::vector<vert_t>({c, SIGMA(c)})) {
         --no_v;
         //swap vertices in L and fix IL, move v 'out-of-scope'
         std::swap( L[ IL[VC[v]] ], L[ no_v ] );
@@ -202,10 +314,10 @@ void graph_lhgr::remove_vert(const var_t c) noexcept {
 
 vec<bool> exists_edge_to_c( 100, false ); //TODO instead of large array use hash_set?
 //merges colors v1 and v2, color of v2 will be set to color of v1; and color of SIGMA(v2) set to color of SIGMA(v1)
-void graph_lhgr::merge_verts(const var_t v1_, const var_t v2_) noexcept {
+void graph_lhgr::merge_verts(const vert_t v1_, const vert_t v2_) noexcept {
     //std::cout << "no_v = " << std::to_string(no_v) << "; merging " << std::to_string(VC[v1]) << " and " << std::to_string(VC[v2]) << " (" << std::to_string(VC[SIGMA(v1)]) << " and " << std::to_string(VC[SIGMA(v2)]) << ")" << std::endl;
-    const var_t v1 = VC[v1_];
-    const var_t v2 = VC[v2_];
+    const vert_t v1 = VC[v1_];
+    const vert_t v2 = VC[v2_];
     //abort if already merged!
     if(VC[v1]==VC[v2]) return;
 
@@ -229,7 +341,7 @@ void graph_lhgr::merge_verts(const var_t v1_, const var_t v2_) noexcept {
     
     //adjust CAL s.t. v2 is part of color list of v1
     //update vert cols
-    for (auto &&v : CAL[v2]) VC[v] = v1;
+    for (auto &&v : CAL[v2]) { VC_pg.touch(v); VC[v] = v1; }
     //update color list
     CAL[v1].splice(CAL[v1].end(), CAL[v2]);
     
@@ -249,32 +361,37 @@ void graph_lhgr::merge_verts(const var_t v1_, const var_t v2_) noexcept {
     
         //adjust CAL s.t. sigma(v2) is part of list of sigma(v1)
         //update vert cols
-        var_t VC_sigma_v2 = VC[SIGMA(v2)];
-        for (auto &&v : CAL[VC_sigma_v2]) VC[v] = VC[SIGMA(v1)];
+        vert_t VC_sigma_v2 = VC[SIGMA(v2)];
+        for (auto &&v : CAL[VC_sigma_v2]) { VC_pg.touch(v); VC[v] = VC[SIGMA(v1)]; }
         //update color list
         CAL[VC[SIGMA(v1)]].splice(CAL[VC[SIGMA(v1)]].end(), CAL[VC_sigma_v2]);
     }
 
 
     //adjust out-going edges, i.e., remove all duplicate edges between same colours
+    remove_duplicate_edges_(v1);
+    //adjust in-going edges, by remove all duplicate out-going edges between same colours of SIGMA(v1)
+    if(VC[SIGMA(v2)] != v1) remove_duplicate_edges_(VC[SIGMA(v1)]);
+};
+
+void graph_lhgr::remove_duplicate_edges_(const vert_t c) noexcept {
     //loop over verts of same color and remove each one of them
     exists_edge_to_c.resize(no_v,false);
     assert(std::all_of(exists_edge_to_c.begin(), exists_edge_to_c.end(), [](const bool v){ return !v; }));
-    std::list<var_t> needs_reset;
-    //std::fill(exists_edge_to_c.begin(),exists_edge_to_c.end(), false);
+    std::list<vert_t> needs_reset;
     //note IL[VC[w]] == IL[VC[w']] iff VC[w] == VC[w'], and we have IL[VC[w]] in [0,...,no_v-1]; hence we access color c via IL[c]
-    exists_edge_to_c[ IL[v1] ] = true; //avoid edges from color to itself
-    needs_reset.emplace_back( IL[v1] );
-    for (const auto &w : CAL[ v1 ]) {
+    exists_edge_to_c[ IL[c] ] = true; //avoid edges from color to itself
+    needs_reset.emplace_back( IL[c] );
+    for (const auto &w : CAL[ c ]) {
         //loop through out-edges
-        for (var_t idx = 0; idx < VD_out[w]; ++idx) //cannot be run in parallel, as remove_edge decreases VD_out !
+        for (vert_t idx = 0; idx < VD_out[w]; ++idx) //cannot be run in parallel, as remove_edge decreases VD_out !
         {
-            if(!exists_edge_to_c[ IL[ VC[AL_out[w][idx]] ] ]) {
-                exists_edge_to_c[ IL[ VC[AL_out[w][idx]] ] ] = true; //only one edge is kept!
-                needs_reset.emplace_back( IL[VC[AL_out[w][idx]]] );
+            if(!exists_edge_to_c[ IL[ VC[AL_out_(w, idx)] ] ]) {
+                exists_edge_to_c[ IL[ VC[AL_out_(w, idx)] ] ] = true; //only one edge is kept!
+                needs_reset.emplace_back( IL[VC[AL_out_(w, idx)]] );
             } else {
                 //there is already an edge; i.e., remove it -- except it is self-symmetric (i.e. v->w and sigma(w)->sigma(v) coincide), then remove only one of the edges!
-                if( VC[w] != VC[ SIGMA(AL_out[w][idx]) ] ) {
+                if( VC[w] != VC[ SIGMA(AL_out_(w, idx)) ] ) {
                     remove_edge(w, idx);
                 } else {
                     remove_edge_(w, idx);
@@ -285,55 +402,70 @@ void graph_lhgr::merge_verts(const var_t v1_, const var_t v2_) noexcept {
     }
     //reset exists_edge_to_c
     for(const auto idx : needs_reset) exists_edge_to_c[ idx ] = false;
-    needs_reset.clear();
     assert(std::all_of(exists_edge_to_c.begin(), exists_edge_to_c.end(), [](const bool v){ return !v; }));
+};
 
-    if(VC[SIGMA(v2)] != v1) {
-        //adjust in-going edges, by remove all duplicate out-going edges between same colours of SIGMA(v1)
-        //loop over verts of same color and remove each one of them
-        exists_edge_to_c.resize(no_v, false);
-        //note IL[VC[w]] == IL[VC[w']] iff VC[w] == VC[w'], and we have IL[VC[w]] in [0,...,no_v-1]; hence we access color c via IL[c]
-        exists_edge_to_c[ IL[VC[SIGMA(v1)]] ] = true; //avoid edges from color to itself
-        needs_reset.emplace_back( IL[VC[SIGMA(v1)]] );
-        for (const auto &w : CAL[ VC[SIGMA(v1)] ]) {
-            //loop through out-edges
-            for (var_t idx = 0; idx < VD_out[w]; ++idx) //cannot be run in parallel, as remove_edge decreases VD_out !
-            {
-                if(!exists_edge_to_c[ IL[ VC[AL_out[w][idx]] ] ]) {
-                    exists_edge_to_c[ IL[ VC[AL_out[w][idx]] ] ] = true; //only one edge is kept!
-                    needs_reset.emplace_back( IL[VC[AL_out[w][idx]]] );
-                } else {
-                    //there is already an edge; i.e., remove it -- except it is self-symmetric (i.e. v->w and sigma(w)->sigma(v) coincide), then remove only one of the edges!
-                    if( VC[w] != VC[ SIGMA(AL_out[w][idx]) ] ) {
-                        remove_edge(w, idx);
-                    } else {
-                        remove_edge_(w, idx);
-                    }
-                    --idx; //decrease idx, as we still need to check whether AL_out[w][idx] needs to be removed (!)
-                }
-            }
+void graph_lhgr::link_colors_(const vert_t c1, const vert_t c2) noexcept {
+    --no_v;
+    //move c2 out-of-scope
+    std::swap( L[ IL[c2] ], L[ no_v ] );
+    //fix IL accordingly
+    std::swap( IL[ L[IL[c2]] ], IL[ L[no_v] ] );
+    assert( IL[L[no_v]] == no_v );
+    //adjust degree of enlarged color
+    CD_out[ c1 ] += CD_out[ c2 ];
+    CD_out[ c2 ] = 0;
+    //c2 points to c1, the verts of its color class are relabelled at the end of the batch
+    VC_pg.touch(c2);
+    VC[c2] = c1;
+    CAL[c1].splice(CAL[c1].end(), CAL[c2]);
+    merged_cs.push_back(c1);
+};
+
+void graph_lhgr::merge_verts(const vec< std::pair<vert_t,vert_t> >& merge_list) noexcept {
+    merged_cs.clear();
+    //(1) link color classes; VC is used as union-find forest
+    for(const auto& [v1_, v2_] : merge_list) {
+        const vert_t v1 = find_color_(v1_);
+        const vert_t v2 = find_color_(v2_);
+        //abort if already merged!
+        if(v1 == v2) continue;
+        link_colors_(v1, v2);
+        //perform the same steps for the symmetric nodes sigma(v1) and sigma(v2) -- if they are distinct!
+        const vert_t s2 = find_color_(SIGMA(v2));
+        if(s2 != v1) link_colors_(find_color_(SIGMA(v1)), s2);
+    }
+    if(merged_cs.empty()) return;
+    //(2) resolve colors of enlarged classes
+    for(auto& c : merged_cs) c = find_color_(c);
+    std::sort(merged_cs.begin(), merged_cs.end());
+    merged_cs.erase( std::unique(merged_cs.begin(), merged_cs.end()), merged_cs.end() );
+    for(const auto c : merged_cs) {
+        for(const auto v : CAL[c]) {
+            if(VC[v] == c) continue;
+            VC_pg.touch(v);
+            VC[v] = c;
         }
-        //reset exists_edge_to_c
-        for(const auto idx : needs_reset) exists_edge_to_c[ idx ] = false;
-        needs_reset.clear();
-        assert(std::all_of(exists_edge_to_c.begin(), exists_edge_to_c.end(), [](const bool v){ return !v; }));
     }
+    //(3) remove duplicate edges once per enlarged color; merged_cs is closed under SIGMA, i.e., this also removes duplicate in-edges
+    for(const auto c : merged_cs) remove_duplicate_edges_(c);
+    assert( graph_lhgr::assert_data_structs() );
 };
 
 bool graph_lhgr::assert_data_structs() const noexcept {
-    assert(no_e <= no_v*no_v-no_v);
-    var_t total_d_orig_out = 0;
-    var_t total_d_out = 0;
-    for (var_t u = 0; u < L.size(); ++u) {
+    assert((uint64_t) no_e <= (uint64_t) no_v*no_v-no_v);
+    edge_cnt_t total_d_orig_out = 0;
+    edge_cnt_t total_d_out = 0;
+    for (vert_t u = 0; u < L.size(); ++u) {
         //check validity of AL and AL_in (and JAL)
         //AL_out[ AL_in[u,i], IAL_in[u,i] ] = u for all u (not only active ones!) and all i (up to orig degree of u!)
-        for (var_t i = 0; i < AL_out[u].size(); i++) {
-            //std::cout << AL_out[SIGMA(AL_out[u)[i]] ][IAL_in[u][i]] << " == " << SIGMA(u) << std::endl;
-            assert( AL_out[ SIGMA(AL_out[u][i]) ][IAL_in[u][i]] == SIGMA(u) );
+        for (vert_t i = 0; i < AL_size[u]; i++) {
+            //std::cout << AL_out_(SIGMA(AL_out_(u, i)), IAL_in_(u, i)) << " == " << SIGMA(u) << std::endl;
+            assert( AL_out_(SIGMA(AL_out_(u, i)), IAL_in_(u, i)) == SIGMA(u) );
         }
         //std::cout << std::endl;
         //get orig d_out
-        const var_t d_orig_out = AL_out[u].size();
+        const vert_t d_orig_out = AL_size[u];
 
         //check upper bound on degree vecs
         assert(d_orig_out >= VD_out[u]);
@@ -347,10 +479,10 @@ bool graph_lhgr::assert_data_structs() const noexcept {
     assert( total_d_out <= total_d_orig_out );
     
     //check correct bounds of CAL, and resp cardinalities and degrees
-    for (var_t c_idx = 0; c_idx < no_v; ++c_idx) {
+    for (vert_t c_idx = 0; c_idx < no_v; ++c_idx) {
         //get color at c_idx
-        const var_t c = L[c_idx];
-        var_t cd_out = 0;
+        const vert_t c = L[c_idx];
+        vert_t cd_out = 0;
 
         //loop over verts of same color
         for (const auto &v : CAL[c]) cd_out = cd_out + VD_out[v];
@@ -360,7 +492,7 @@ bool graph_lhgr::assert_data_structs() const noexcept {
     }
 
     //check that L and IL match!
-    for (var_t u = 0; u < L.size(); ++u) {
+    for (vert_t u = 0; u < L.size(); ++u) {
         assert( L[ IL[u] ] == u && IL[ L[u] ] == u );
     }
 
@@ -368,16 +500,16 @@ bool graph_lhgr::assert_data_structs() const noexcept {
 };
 
 std::string graph_lhgr::to_str() const noexcept {
-    std::map<var_t, vec<var_t> > edges;
-    for (var_t c_idx = 0; c_idx < no_v; ++c_idx) {
+    std::map<vert_t, vec<vert_t> > edges;
+    for (vert_t c_idx = 0; c_idx < no_v; ++c_idx) {
         //get color at c_idx
-        const var_t c = VC[ L[c_idx] ];
+        const vert_t c = VC[ L[c_idx] ];
         //add all out-neighbors to edges[c_idx]
         edges[c] = get_out_neighbour_vector( c );
         //iterate over all verts of color c
         //for (auto &&v : CAL[c]) {
         //    //add out-neighbors of v to edges[c_idx]
-        //    for (var_t i = 0; i < VD_out[v]; ++i) {
+        //    for (vert_t i = 0; i < VD_out[v]; ++i) {
         //        edges[ c ].push_back( VC[ AL_out[v][i] ] );
         //    }
         //}
@@ -388,11 +520,11 @@ std::string graph_lhgr::to_str() const noexcept {
 
     //generate string of edges with lexicographic ordering!
     vec< std::string > str_edges(0);
-    for( std::map<var_t, vec<var_t>>::iterator iter = edges.begin(); iter != edges.end(); ++iter ) {
+    for( std::map<vert_t, vec<vert_t>>::iterator iter = edges.begin(); iter != edges.end(); ++iter ) {
         vec<std::string> out_edges_str( iter->second.size() );
         //construct strings!
-        const var_t src = iter->first;
-        auto to_str = [src](const var_t dst) -> std::string {return "("+std::to_string(src)+","+std::to_string(dst)+")";};
+        const vert_t src = iter->first;
+        auto to_str = [src](const vert_t dst) -> std::string {return "("+std::to_string(src)+","+std::to_string(dst)+")";};
         std::transform(iter->second.begin(), iter->second.end(), out_edges_str.begin(), to_str);
 
         std::stringstream ss;
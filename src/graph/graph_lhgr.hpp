@@ -20,6 +20,7 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <list>
 #include <map>
 #include <algorithm>
@@ -28,6 +29,8 @@
 #include <iostream>
 #include <iterator>
 #include <ranges>
+#include <memory>
+#include <span>
 
 #include "../misc.hpp"
 
@@ -36,24 +39,119 @@
  *         'A Hybrid Graph Representation for Exact Graph Algorithms'
  */
 
+//number of entries of VD_out and VC per page; snapshots share all pages that were not modified in between
+#define LHGR_PAGE_SIZE 64
+
+typedef std::array<vert_t, LHGR_PAGE_SIZE> lhgr_page;
+
+/**
+ * @brief copy-on-write paging of a vector for snapshots; a snapshot is a vector of (shared) pages, and only pages modified since the previous snapshot are copied
+ */
+class lhgr_pages {
+  private:
+    //pages holding the contents of the vector at the time of the last snapshot (or restore)
+    vec< std::shared_ptr<const lhgr_page> > pg;
+    //dirty[p] is true iff page p was modified since the last snapshot (or restore)
+    vec<bool> dirty;
+    //list of dirty pages
+    vec<vert_t> dirty_pgs;
+
+    inline void copy_page(vec<vert_t>& A, const lhgr_page& P, const vert_t p) const noexcept {
+      const size_t off = (size_t) p * LHGR_PAGE_SIZE;
+      std::copy(P.begin(), P.begin() + std::min((size_t) LHGR_PAGE_SIZE, A.size() - off), A.begin() + off);
+    };
+
+    inline std::shared_ptr<const lhgr_page> make_page(const vec<vert_t>& A, const vert_t p) const noexcept {
+      auto P = std::make_shared<lhgr_page>();
+      const size_t off = (size_t) p * LHGR_PAGE_SIZE;
+      std::copy(A.begin() + off, A.begin() + off + std::min((size_t) LHGR_PAGE_SIZE, A.size() - off), P->begin());
+      return P;
+    };
+
+  public:
+    lhgr_pages() noexcept = default;
+
+    /**
+     * @brief initializes pages with the contents of A
+     * 
+     * @param A vector to be paged
+     */
+    void init(const vec<vert_t>& A) noexcept {
+      const vert_t no_pg = (A.size() + LHGR_PAGE_SIZE - 1) / LHGR_PAGE_SIZE;
+      pg.resize(no_pg);
+      for(vert_t p = 0; p < no_pg; ++p) pg[p] = make_page(A, p);
+      dirty.assign(no_pg, false);
+      dirty_pgs.clear();
+    };
+
+    /**
+     * @brief must be called before A[i] is modified
+     * 
+     * @param i idx in paged vector
+     */
+    inline void touch(const vert_t i) noexcept {
+      const vert_t p = i / LHGR_PAGE_SIZE;
+      if(!dirty[p]) { dirty[p] = true; dirty_pgs.push_back(p); }
+    };
+
+    /**
+     * @brief get snapshot of A; copies only the pages modified since the last snapshot
+     * 
+     * @param A paged vector
+     * @return vec< std::shared_ptr<const lhgr_page> > pages representing the current contents of A
+     * @note implementation is in O( #pages + #modified pages * LHGR_PAGE_SIZE )
+     */
+    vec< std::shared_ptr<const lhgr_page> > snapshot(const vec<vert_t>& A) noexcept {
+      for(const auto& p : dirty_pgs) {
+        pg[p] = make_page(A, p);
+        dirty[p] = false;
+      }
+      dirty_pgs.clear();
+      return pg;
+    };
+
+    /**
+     * @brief restore A from snapshot pg_; only pages that differ from the current ones are copied
+     * 
+     * @param A paged vector
+     * @param pg_ snapshot of A
+     */
+    void restore(vec<vert_t>& A, vec< std::shared_ptr<const lhgr_page> >&& pg_) noexcept {
+      for(vert_t p = 0; p < pg.size(); ++p) {
+        if(dirty[p] || pg[p] != pg_[p]) copy_page(A, *pg_[p], p);
+      }
+      for(const auto& p : dirty_pgs) dirty[p] = false;
+      dirty_pgs.clear();
+      pg = std::move(pg_);
+    };
+
+    /**
+     * @brief number of pages of the paged vector
+     */
+    inline vert_t size() const noexcept { return pg.size(); };
+};
+
 // struct that contains all information required for backtracking the graph
 class graph_lhgr_repr {
   public:
     //number of active vertices
-    var_t no_v;
+    vert_t no_v;
     //number of active edges
-    var_t no_e;
+    edge_cnt_t no_e;
 
-    //degree vector -- VD[v] is degree of vertex v
-    vec<var_t> VD_out;
+    //degree vector -- pages of VD[v], the degree of vertex v
+    vec< std::shared_ptr<const lhgr_page> > VD_out;
 
-    //color vector -- VC[v] is color of vertex v
-    vec<var_t> VC;
+    //color vector -- pages of VC[v], the color of vertex v
+    vec< std::shared_ptr<const lhgr_page> > VC;
+
+    //number of edge insertions on the trail -- all later insertions are undone on backtrack
+    edge_cnt_t no_ins;
 
     //ctor for graph_lhgr_repr
-    graph_lhgr_repr(const var_t _no_v, const var_t _no_e, const vec<var_t>& _VD_out, const vec<var_t>& _VC) noexcept : no_v(_no_v), no_e(_no_e), VD_out(_VD_out), VC(_VC) {};
-    graph_lhgr_repr(const graph_lhgr_repr& o) noexcept : no_v(o.no_v), no_e(o.no_e), VD_out(o.VD_out), VC(o.VC) {};
-    graph_lhgr_repr(graph_lhgr_repr&& o) noexcept : no_v(std::move(o.no_v)), no_e(std::move(o.no_e)), VD_out(std::move(o.VD_out)), VC(std::move(o.VC)) {};
+    graph_lhgr_repr(const vert_t _no_v, const edge_cnt_t _no_e, vec< std::shared_ptr<const lhgr_page> >&& _VD_out, vec< std::shared_ptr<const lhgr_page> >&& _VC, const edge_cnt_t _no_ins = 0) noexcept : no_v(_no_v), no_e(_no_e), VD_out(std::move(_VD_out)), VC(std::move(_VC)), no_ins(_no_ins) {};
+    graph_lhgr_repr(const graph_lhgr_repr& o) noexcept : no_v(o.no_v), no_e(o.no_e), VD_out(o.VD_out), VC(o.VC), no_ins(o.no_ins) {};
+    graph_lhgr_repr(graph_lhgr_repr&& o) noexcept : no_v(std::move(o.no_v)), no_e(std::move(o.no_e)), VD_out(std::move(o.VD_out)), VC(std::move(o.VC)), no_ins(o.no_ins) {};
     ~graph_lhgr_repr() = default;
 };
 
@@ -67,70 +165,124 @@ class graph_lhgr {
     /* 
      *  number of (active) vertices
      */
-    var_t no_v;
+    vert_t no_v;
 
     /* 
      *  number of edges
      */
-    var_t no_e;
+    edge_cnt_t no_e;
     
     /*
      *  L list of vertices
      *  O( no_v )
      */
-    vec<var_t> L;
+    vec<vert_t> L;
 
     /*
      *  IL - index of vertex in L
      *  O( no_v )
      */ 
-    vec<var_t> IL;
+    vec<vert_t> IL;
     
     /*
-     *  AL - adjacency list
+     *  AL - adjacency lists, shared by the skew-symmetric verts 2x and 2x+1 = sigma(2x), i.e., AL[x] is the only allocation for both
+     *  the first half of AL[x] holds the targets AL_out[v,i], the second half the 'inverse' indices IAL_in[v,i] (at the same offsets);
+     *  the out-edges of 2x fill each half from the front, the out-edges of 2x+1 from the back (see AL_out_ and IAL_in_)
      *  O( no_e )
+     *  satisfies:
+     *     sigma( AL_out[ sigma(AL_out[v,i]), IAL_in[v,i] ] ) = v
      */ 
-    vec< vec<var_t> > AL_out;
-    
+    vec< vec<vert_t> > AL;
+
     /*
-     *  IAL - 'inverse' adjacency list
-     *  O( no_e )
-     *  satisfies:
-     *     sigma( AL_out[ sigma(AL_out[v,i]), ILA_in[v,i] ] ) = v
+     *  AL_size - number of out-edges of v stored in AL, including out-of-scope ones
+     *  O( no_v )
      */ 
-    vec< vec<var_t> > IAL_in;
+    vec<vert_t> AL_size;
     
     
     /*
      *  CAL - singly linked list of vertices by color
      *  O( no_v )
      */ 
-    vec< std::list<var_t> > CAL;
+    vec< std::list<vert_t> > CAL;
 
     /*
      *  VC - list of vertex colors
      *  O( no_v )
      */ 
-    vec<var_t> VC;
+    vec<vert_t> VC;
 
     /*
      *  CD - array of color out-degrees
      *  O( no_v )
      */ 
-    vec<var_t> CD_out;
+    vec<vert_t> CD_out;
 
     /*
      *  VD - list of vertex out-degrees
      *  O( no_v )
      */ 
-    vec<var_t> VD_out;
+    vec<vert_t> VD_out;
+
+    /*
+     *  trail of edges inserted with add_edge, stores (src, dst, VD_out[src], VD_out[sigma(dst)]) at time of insertion
+     *  O( #insertions )
+     */
+    vec< std::array<vert_t,4> > ins_trail;
+
+    /*
+     *  copy-on-write pages of VD_out and VC for get_state()
+     *  O( no_v / LHGR_PAGE_SIZE )
+     */
+    mutable lhgr_pages VD_out_pg;
+    mutable lhgr_pages VC_pg;
 
     /**
      * @brief skey-symmetry w.r.t sigma, we have (v,w) in E iff (SIGMA(w)(v)) is in E
      * 
      * @note this allows us to only store out-going edges for each node, as AL_in[v] = sigma( AL_out[ sigma(v) ] )
      */
-    //vec<var_t> sigma;
+    //vec<vert_t> sigma;
+
+    /**
+     * @brief capacity of each half of AL[v>>1], i.e., the max number of out-edges v and sigma(v) can store together
+     */
+    inline size_t al_cap_(const vert_t v) const noexcept { return AL[v>>1].size()/2; };
+
+    /**
+     * @brief position of the i-th out-edge of v in each half of AL[v>>1]
+     */
+    inline size_t al_pos_(const vert_t v, const vert_t i) const noexcept { return (v&1) ? al_cap_(v)-1-i : i; };
+
+    /**
+     * @brief target of i-th out-edge of v
+     */
+    inline vert_t& AL_out_(const vert_t v, const vert_t i) noexcept { return AL[v>>1][ al_pos_(v,i) ]; };
+    inline const vert_t& AL_out_(const vert_t v, const vert_t i) const noexcept { return AL[v>>1][ al_pos_(v,i) ]; };
+
+    /**
+     * @brief index of the symmetric edge of the i-th out-edge of v in the out-edges of sigma(AL_out_(v,i))
+     */
+    inline vert_t& IAL_in_(const vert_t v, const vert_t i) noexcept { return AL[v>>1][ al_cap_(v) + al_pos_(v,i) ]; };
+    inline const vert_t& IAL_in_(const vert_t v, const vert_t i) const noexcept { return AL[v>>1][ al_cap_(v) + al_pos_(v,i) ]; };
+
+    /**
+     * @brief range over the targets of the in-scope out-edges of v
+     */
+    inline std::span<const vert_t> out_span_(const vert_t v) const noexcept {
+      const vert_t* d = AL[v>>1].data();
+      return (v&1) ? std::span<const vert_t>(d + al_cap_(v) - VD_out[v], VD_out[v]) : std::span<const vert_t>(d, VD_out[v]);
+    };
+
+    /**
+     * @brief appends out-edge v->dst whose symmetric edge has index mir; doubles the capacity of AL[v>>1] if necessary
+     * 
+     * @param v source vert
+     * @param dst dest vert
+     * @param mir index of symmetric edge in out-edges of sigma(dst)
+     */
+    void push_edge_(const vert_t v, const vert_t dst, const vert_t mir) noexcept;
 
     /**
      * @brief removes edge src->AL_out[src][idx] from the graph; does not touch its symmetrical edge!
@@ -138,7 +290,62 @@ class graph_lhgr {
      * @param src source of edge
      * @param idx index of target in AL_out[src]
      */
-    void remove_edge_(const var_t src, const var_t idx) noexcept;
+    void remove_edge_(const vert_t src, const vert_t idx) noexcept;
+
+    /**
+     * @brief appends edge src->dst and its symmetric edge to AL_out (and IAL_in) without adjusting degrees
+     * 
+     * @param src source vert
+     * @param dst dest vert
+     */
+    void append_edge_(const vert_t src, const vert_t dst) noexcept;
+
+    /**
+     * @brief swaps the i-th and j-th entry of AL_out[src] and fixes IAL_in of both entries and their symmetric edges
+     * 
+     * @param src source vert
+     * @param i index in AL_out[src]
+     * @param j index in AL_out[src]
+     */
+    void swap_edges_(const vert_t src, const vert_t i, const vert_t j) noexcept;
+
+    /**
+     * @brief undoes the last edge insertion on ins_trail
+     * @note must be called before VD_out is restored, i.e., in reverse order of insertion
+     */
+    void undo_insertion_() noexcept;
+
+    /**
+     * @brief removes all duplicate out-edges of color c, i.e., keeps only one edge to each color, and removes edges to c itself
+     * 
+     * @param c color
+     * @note implementation is in O( CD_out[c] )
+     */
+    void remove_duplicate_edges_(const vert_t c) noexcept;
+
+    /**
+     * @brief moves color c2 out-of-scope and appends its color class to the one of c1; VC of the verts of c2 is not updated, i.e., VC is a union-find forest afterwards
+     * 
+     * @param c1 color to merge with
+     * @param c2 color to be merged
+     */
+    void link_colors_(const vert_t c1, const vert_t c2) noexcept;
+
+    /**
+     * @brief finds the color of v, when VC is a union-find forest (see link_colors_)
+     * 
+     * @param v vert
+     * @return vert_t color of v
+     */
+    inline vert_t find_color_(vert_t v) const noexcept {
+      while(VC[v] != v) v = VC[v];
+      return v;
+    };
+
+    /*
+     *  colors whose color class was enlarged in the current batch merge
+     */
+    vec<vert_t> merged_cs;
 
   public:
     /**
@@ -150,9 +357,9 @@ class graph_lhgr {
      *  @param E     vector of vector of idx of edges, i.e., we have edge (u,v) iff v is in E[u],
      *               note that the vertices have to be in {0,..,no_v_-1} and there should be EXACTLY no_e_ edges in total.
      */ 
-    graph_lhgr(const vec< std::pair<var_t,var_t> >& E, const var_t no_v) noexcept;
+    graph_lhgr(const vec< std::pair<vert_t,vert_t> >& E, const vert_t no_v) noexcept;
     
-    graph_lhgr(const graph_lhgr& g) noexcept : no_v(g.no_v), no_e(g.no_e), L(g.L), IL(g.L), AL_out(g.AL_out), IAL_in(g.IAL_in), CAL(g.CAL), VC(g.VC), CD_out(g.CD_out), VD_out(g.VD_out) {};
+    graph_lhgr(const graph_lhgr& g) noexcept : no_v(g.no_v), no_e(g.no_e), L(g.L), IL(g.IL), AL(g.AL), AL_size(g.AL_size), CAL(g.CAL), VC(g.VC), CD_out(g.CD_out), VD_out(g.VD_out), ins_trail(g.ins_trail), VD_out_pg(g.VD_out_pg), VC_pg(g.VC_pg) {};
 
     graph_lhgr() noexcept = default;
     
@@ -166,30 +373,55 @@ class graph_lhgr {
      *  @param E     vector of vector of idx of edges, i.e., we have edge (u,v) iff v is in E[u],
      *               note that the vertices have to be in {0,..,no_v_-1} and there should be EXACTLY no_e_ edges in total.
      */ 
-    void init(const vec< std::pair<var_t,var_t> >& E, const var_t no_v_) noexcept;
+    void init(const vec< std::pair<vert_t,vert_t> >& E, const vert_t no_v_) noexcept;
 
     /**
-     * @brief adds new edge from src to dst; and its skew-symmetric edge
+     * @brief adds new edge from color of src to color of dst; and its skew-symmetric edge
      * 
      * @param src source vert
      * @param dst dest vert
-     * @note breaks graph_lhgr_repr produced with get_state(); i.e., after adding an edge backtrack cannot be used with older states!
+     * @return true iff the edge was inserted, i.e., it was not present before
+     * @note backtracking to a graph_lhgr_repr produced with get_state() before the insertion removes the edge again; states produced afterwards keep it
+     * @note implementation is in O( CD_out[src] )
      */
-    void add_edge(const var_t src, const var_t dst) noexcept;
+    bool add_edge(const vert_t src, const vert_t dst) noexcept;
     
     /**
      * @brief Get number of (active) verts of graph
      * 
-     * @return var_t number of verts
+     * @return vert_t number of verts
      */
-    inline var_t get_no_v() const noexcept { return no_v; };
+    inline vert_t get_no_v() const noexcept { return no_v; };
     
     /**
      * @brief Get number of (active) edges of graph
      * 
-     * @return var_t number of edges
+     * @return edge_cnt_t number of edges
      */
-    inline var_t get_no_e() const noexcept { return no_e; };
+    inline edge_cnt_t get_no_e() const noexcept { return no_e; };
+
+    /**
+     * @brief Get total number of verts, i.e., active and inactive ones; all verts are in {0,...,get_no_v_total()-1}
+     * 
+     * @return vert_t number of verts
+     */
+    inline vert_t get_no_v_total() const noexcept { return L.size(); };
+
+    /**
+     * @brief checks whether v is an active vert, i.e., it was neither removed nor merged into another vert
+     * 
+     * @param v vert
+     * @return true iff v is active
+     */
+    inline bool is_active(const vert_t v) const noexcept { return IL[v] < no_v; };
+
+    /**
+     * @brief Get color of v, i.e., the active vert that represents v
+     * 
+     * @param v vert
+     * @return vert_t color of v
+     */
+    inline vert_t get_color(const vert_t v) const noexcept { return VC[v]; };
 
     /**
      * @brief Get range over all active verts
@@ -205,8 +437,8 @@ class graph_lhgr {
      * 
      * @return vector of out-neighbours
      */
-    vec<var_t> get_v_vector() const noexcept {
-      vec<var_t> vs(no_v);
+    vec<vert_t> get_v_vector() const noexcept {
+      vec<vert_t> vs(no_v);
       std::copy(L.begin(), L.begin()+no_v, vs.begin());
       return vs;
     }
@@ -215,8 +447,9 @@ class graph_lhgr {
      * @brief get the a representation of the graph that allows O(1) backtracking
      * 
      * @return graph_lhgr_repr 
+     * @note only pages of VD_out and VC that were modified since the last call are copied
      */
-    inline graph_lhgr_repr get_state() const noexcept { return graph_lhgr_repr(no_v, no_e, VD_out, VC); };
+    inline graph_lhgr_repr get_state() const noexcept { return graph_lhgr_repr(no_v, no_e, VD_out_pg.snapshot(VD_out), VC_pg.snapshot(VC), ins_trail.size()); };
 
     /**
      *  @brief backtrack to graph represented by graph_orig
@@ -233,7 +466,18 @@ class graph_lhgr {
      *  @warning use with care! function is not compatible with vertex-removal+backtracking (as order in AL might change)!
      *  @note implementation is in O(1)
      */
-    void remove_edge(const var_t src, const var_t idx) noexcept;
+    void remove_edge(const vert_t src, const vert_t idx) noexcept;
+
+    /**
+     *  @brief removes the edge from the color of src to the color of dst and its symmetrical counterpart
+     * 
+     *  @param src source vertex
+     *  @param dst dst vertex
+     *  @return true iff the edge was present, i.e., it was removed
+     *  @note backtracking to a graph_lhgr_repr produced with get_state() before the removal restores the edge
+     *  @note implementation is in O( CD_out[src] )
+     */
+    bool erase_edge(const vert_t src, const vert_t dst) noexcept;
     
     /**
      *  @brief removes all out-going and incoming edges of v (faster than removing the edges one-by-one) and their symmetrical counterparts
@@ -241,7 +485,7 @@ class graph_lhgr {
      *  @param v v vertex
      *  @note implementation is in O( CD_out[v]+CD_out[sigma(v)] )
      */
-    void remove_all_edges(const var_t v) noexcept;
+    void remove_all_edges(const vert_t v) noexcept;
 
     /**
      *  @brief removes vertex v and its symmetric counterpart from the graph
@@ -250,7 +494,7 @@ class graph_lhgr {
      *  @note also removes all outgoing edges
      *  @note implementation is in O( CD_out[v]+CD_out[sigma(v)] )
      */
-    void remove_vert(const var_t v) noexcept;
+    void remove_vert(const vert_t v) noexcept;
 
     /**
      * @brief merges vertices v1 and v2, color of v2 will be set to color of v1 (also merges the symmetric counterparts!)
@@ -259,7 +503,16 @@ class graph_lhgr {
      * @param v2 vertex to be merged with
      * @note implementation is in O( CD_out[v1]+CD_out[sigma(v1)]+CD_out[v2]+CD_out[sigma(v2)] );
      */
-    void merge_verts(const var_t v1, const var_t v2) noexcept;
+    void merge_verts(const vert_t v1, const vert_t v2) noexcept;
+
+    /**
+     * @brief merges v2 into v1 for every pair (v1,v2) in merge_list (in the given order), and their symmetric counterparts; same as calling merge_verts(v1,v2) for each pair
+     * 
+     * @param merge_list pairs of verts to be merged
+     * @note color classes are resolved with union-find; duplicate edges are removed only once per resulting color, i.e., implementation is in O( |merge_list| + sum of CD_out of all merged colors + size of their color classes )
+     * @warning merge_list must not (transitively) merge a vertex with its symmetric counterpart
+     */
+    void merge_verts(const vec< std::pair<vert_t,vert_t> >& merge_list) noexcept;
 
     /**
      * @brief get out-degree of vertex (i.e. degree of its color!)
@@ -267,7 +520,7 @@ class graph_lhgr {
      * @param v vertex (color)
      * @return out-degree of vert (color)
      */
-    inline var_t get_out_degree(const var_t v) const noexcept { return CD_out[ VC[v] ]; };
+    inline vert_t get_out_degree(const vert_t v) const noexcept { return CD_out[ VC[v] ]; };
 
     /**
      * @brief Get range over out-neighbours of v 
@@ -275,10 +528,10 @@ class graph_lhgr {
      * @param v vertex v
      * @return range over out-neighbors
      */
-    inline auto get_out_neighbour_range(const var_t v) const noexcept {
+    inline auto get_out_neighbour_range(const vert_t v) const noexcept {
       return CAL[ VC[v] ] | std::views::transform(
                              [this](const auto& w)
-                             { return AL_out[w] | std::ranges::views::take(VD_out[w]); }
+                             { return out_span_(w); }
                             )
                           | std::views::join
                           | std::views::transform(
@@ -293,9 +546,9 @@ class graph_lhgr {
      * @param v vertex v
      * @return vector of out-neighbours
      */
-    vec<var_t> get_out_neighbour_vector(const var_t v) const noexcept {
+    vec<vert_t> get_out_neighbour_vector(const vert_t v) const noexcept {
       auto r = get_out_neighbour_range(v);
-      vec<var_t> out_n;
+      vec<vert_t> out_n;
       std::ranges::copy(r, std::back_inserter(out_n));
       return out_n;
     }
@@ -306,7 +559,7 @@ class graph_lhgr {
      * @param v vertex (color)
      * @return in-degree of vert (color)
      */
-    inline var_t get_in_degree(const var_t v) const noexcept { return CD_out[ VC[ SIGMA(v) ] ]; };
+    inline vert_t get_in_degree(const vert_t v) const noexcept { return CD_out[ VC[ SIGMA(v) ] ]; };
     
     /**
      * @brief Get range over in-neighbours of v 
@@ -314,10 +567,10 @@ class graph_lhgr {
      * @param v vertex v
      * @return range over in-neighbors
      */
-    inline auto get_in_neighbour_range(const var_t v) const noexcept {
+    inline auto get_in_neighbour_range(const vert_t v) const noexcept {
       return CAL[ VC[SIGMA(v)] ] | std::views::transform(
                                     [this](const auto& w)
-                                    { return AL_out[w] | std::ranges::views::take(VD_out[w]); }
+                                    { return out_span_(w); }
                                    )
                                  | std::views::join
                                  | std::views::transform(
@@ -332,9 +585,9 @@ class graph_lhgr {
      * @param v vertex v
      * @return vector of in-neighbours
      */
-    vec<var_t> get_in_neighbour_vector(const var_t v) const noexcept {
+    vec<vert_t> get_in_neighbour_vector(const vert_t v) const noexcept {
       auto r = get_in_neighbour_range(v);
-      vec<var_t> in_n;
+      vec<vert_t> in_n;
       std::ranges::copy(r, std::back_inserter(in_n));
       return in_n;
     }
@@ -357,12 +610,15 @@ class graph_lhgr {
       no_e = g.no_e;
       L = g.L;
       IL = g.IL;
-      AL_out = g.AL_out;
-      IAL_in = g.IAL_in;
+      AL = g.AL;
+      AL_size = g.AL_size;
       CAL = g.CAL;
       VC = g.VC;
       CD_out = g.CD_out;
       VD_out = g.VD_out;
+      ins_trail = g.ins_trail;
+      VD_out_pg = g.VD_out_pg;
+      VC_pg = g.VC_pg;
 
       return *this;
     }
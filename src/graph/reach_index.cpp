@@ -0,0 +1,100 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "reach_index.hpp"
+
+reach_index::reach_index(const graph& G_, const vec<vert_t>& TO, const vec<vert_t>& sources) : G(&G_), n(0) {
+    for(const auto& v : G->get_v_range()) n = std::max(n, (vert_t) (v+1));
+
+    //compute ranks
+    rank = vec<vert_t>(n, n);
+    for(vert_t i = 0; i < TO.size(); ++i) rank[ TO[i] ] = i;
+
+    //compute interval labels of a DFS spanning forest (rooted in vertices in order of TO)
+    pre = vec<vert_t>(n, n);
+    last = vec<vert_t>(n, n);
+    vert_t cnt = 0;
+    //stack of (v, expanded); v is finished when it is popped with expanded==true
+    std::stack< std::pair<vert_t,bool> > st;
+    for(const auto& rt : TO) {
+        if(pre[rt] != n) continue;
+        st.emplace(rt, false);
+        while(!st.empty()) {
+            const auto [v, expanded] = st.top();
+            st.pop();
+            if(expanded) { last[v] = cnt-1; continue; }
+            if(pre[v] != n) continue;
+            pre[v] = cnt++;
+            st.emplace(v, true);
+            for(const auto& w : G->get_out_neighbour_range(v)) {
+                if(pre[w] == n) st.emplace(w, false);
+            }
+        }
+    }
+
+    //compute bit-parallel descendant sets of sources, 64 sources at a time
+    n_src = sources.size();
+    slot = vec<vert_t>(n, n_src);
+    for(vert_t s = 0; s < n_src; ++s) slot[ sources[s] ] = s;
+    const vert_t n_words = (n_src + 63) / 64;
+    desc = vec<uint64_t>( (size_t) n_words * n, 0 );
+    for(vert_t b = 0; b < n_words; ++b) {
+        uint64_t* const d = desc.data() + (size_t) b * n;
+        for(unsigned s = 64*b; s < std::min<unsigned>(n_src, 64*(b+1)); ++s) d[ sources[s] ] |= ((uint64_t) 1) << (s % 64);
+        //propagate along TO, i.e., every vertex is finished before its out-neighbours are processed
+        for(const auto& v : TO) {
+            if(d[v] == 0) continue;
+            for(const auto& w : G->get_out_neighbour_range(v)) d[w] |= d[v];
+        }
+    }
+};
+
+bool reach_index::is_descendant(const vert_t src, const vert_t dst) const {
+    if(src == dst) return true;
+    assert(src < n && dst < n);
+    //dst comes before src in TO
+    if(rank[dst] < rank[src]) return false;
+    //dst in dfs-subtree of src
+    if(pre[src] <= pre[dst] && pre[dst] <= last[src]) return true;
+    //src has a bit-parallel descendant set
+    if(slot[src] < n_src) return (desc[ (size_t) (slot[src]/64) * n + dst ] >> (slot[src] % 64)) & 1;
+    return dfs(src, dst);
+};
+
+bool reach_index::dfs(const vert_t src, const vert_t dst) const {
+    vec<bool> visited(n, false);
+    std::stack<vert_t> st;
+    st.push(src);
+    visited[src] = true;
+    while(!st.empty()) {
+        const vert_t v = st.top();
+        st.pop();
+        for(const auto& w : G->get_out_neighbour_range(v)) {
+            if(w == dst) return true;
+            //skip w if already visited or if dst comes before w in TO
+            if(visited[w] || rank[dst] < rank[w]) continue;
+            //shortcut via interval labels
+            if(pre[w] <= pre[dst] && pre[dst] <= last[w]) return true;
+            visited[w] = true;
+            st.push(w);
+        }
+    }
+    return false;
+};
@@ -0,0 +1,102 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <vector>
+#include <stack>
+#include <stdint.h>
+
+#include "../misc.hpp"
+#include "graph.hpp"
+
+/**
+ * @brief reachability index for a DAG snapshot of a graph; answers 'is there a path src->dst' in (near) O(1)
+ * @note combines topological ranks (O(1) negative answers), interval labels of a DFS spanning forest (O(1) positive answers), and 64-way bit-parallel descendant sets of a given list of source vertices (exact O(1) answers); remaining queries fall back to a rank-pruned DFS
+ * @note the index is only valid as long as the underlying graph is not modified!
+ */
+class reach_index {
+  private:
+    /**
+     * @brief graph the index was built for
+     */
+    const graph* G;
+
+    /**
+     * @brief number of vertex-ids covered by the index (largest active vertex + 1)
+     */
+    vert_t n;
+
+    /**
+     * @brief rank[v] is position of v in the topological order; n if v is not active
+     */
+    vec<vert_t> rank;
+
+    /**
+     * @brief interval labels of DFS spanning forest; w is a tree-descendant of v iff pre[v] <= pre[w] <= last[v]
+     */
+    vec<vert_t> pre;
+    vec<vert_t> last;
+
+    /**
+     * @brief slot[v] is the index of v in the list of sources; n_src if v is no source
+     */
+    vec<vert_t> slot;
+    vert_t n_src;
+
+    /**
+     * @brief bit-parallel descendant sets; bit (s%64) of desc[ (s/64)*n + w ] is set iff source with slot s reaches w
+     */
+    vec<uint64_t> desc;
+
+    /**
+     * @brief rank-pruned DFS from src, used for queries that cannot be answered by the labels
+     */
+    bool dfs(const vert_t src, const vert_t dst) const;
+
+  public:
+    reach_index() noexcept : G(nullptr), n(0), n_src(0) {};
+
+    /**
+     * @brief builds reachability index of G
+     * 
+     * @param G_ graph, must be a DAG
+     * @param TO topological ordering of the active vertices of G_ (as returned by impl_graph::get_TO())
+     * @param sources vertices for which bit-parallel descendant sets are computed; queries with these as src are answered exactly in O(1)
+     * @note runs in O( (no_v+no_e) * (1 + sources.size()/64) )
+     */
+    reach_index(const graph& G_, const vec<vert_t>& TO, const vec<vert_t>& sources = vec<vert_t>());
+
+    ~reach_index() = default;
+
+    /**
+     * @brief checks whether there is a path src->dst
+     * 
+     * @param src source vertex
+     * @param dst destination vertex
+     * @return true iff dst is reachable from src
+     */
+    bool is_descendant(const vert_t src, const vert_t dst) const;
+
+    /**
+     * @brief number of sources with bit-parallel descendant sets
+     */
+    inline vert_t get_no_sources() const noexcept { return n_src; };
+};
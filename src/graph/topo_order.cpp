@@ -0,0 +1,247 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include <algorithm>
+
+#include "topo_order.hpp"
+
+bool topo_order::init(const graph& G) {
+    const vert_t n = G.get_no_v_total();
+    ord = vec<vert_t>(n);
+    pos = vec<vert_t>(n);
+    for(vert_t v = 0; v < n; ++v) { ord[v] = v; pos[v] = v; }
+    mark = vec<uint8_t>(n, 0);
+    done = vec<bool>(n, false);
+    in_deg = vec<vert_t>(n, 0);
+    recompute(G);
+    trail.clear();
+    return valid;
+};
+
+bool topo_order::recompute(const graph& G) {
+    dirty.clear();
+    valid = ord.empty() || sort_range(G, 0, ord.size()-1);
+    assert( assert_data_structs(G) );
+    return valid;
+};
+
+bool topo_order::sort_range(const graph& G, const vert_t lb, const vert_t ub) {
+    //collect active verts in range
+    R.clear();
+    slots.clear();
+    for(unsigned p = lb; p <= ub; ++p) {
+        const vert_t v = pos[p];
+        if(!G.is_active(v)) continue;
+        R.push_back(v);
+        slots.push_back(p);
+        mark[v] = 1;
+        in_deg[v] = 0;
+    }
+    //Kahn's algorithm restricted to R -- all other edges leaving R already respect the order
+    for(const auto& v : R) {
+        for(const auto& w : G.get_out_neighbour_range(v)) if(mark[w]) ++in_deg[w];
+    }
+    TO.clear();
+    for(const auto& v : R) if(in_deg[v] == 0) TO.push_back(v);
+    for(size_t i = 0; i < TO.size(); ++i) {
+        for(const auto& w : G.get_out_neighbour_range(TO[i])) {
+            if(!mark[w]) continue;
+            --in_deg[w];
+            if(in_deg[w] == 0) TO.push_back(w);
+        }
+    }
+    for(const auto& v : R) mark[v] = 0;
+    //if not all verts were sorted, there is a cycle
+    if(TO.size() < R.size()) return false;
+    //put verts in the positions R occupied before
+    for(size_t i = 0; i < TO.size(); ++i) set_pos(TO[i], slots[i]);
+    return true;
+};
+
+bool topo_order::place(const graph& G, const vert_t c, const vert_t alt, const vec<vert_t>& out_c, const vec<vert_t>& out_c_) {
+    //c must be placed before all out-neighbours and after all in-neighbours
+    int64_t lo_out = ord.size();
+    for(const auto& w : out_c) lo_out = std::min<int64_t>(lo_out, ord[w]);
+    int64_t hi_in = -1;
+    for(const auto& w : out_c_) hi_in = std::max<int64_t>(hi_in, ord[ G.get_color(SIGMA(w)) ]);
+
+    if(hi_in < ord[c] && ord[c] < lo_out) return true;
+    if(!G.is_active(alt) && hi_in < ord[alt] && ord[alt] < lo_out) {
+        //swap positions of c and (inactive) alt
+        const vert_t p = ord[c];
+        set_pos(c, ord[alt]);
+        set_pos(alt, p);
+        return true;
+    }
+    return false;
+};
+
+void topo_order::merge([[maybe_unused]] const graph& G, const vert_t v1, const vert_t v2) {
+    if(valid) dirty.emplace_back(v1, v2);
+};
+
+bool topo_order::reorder(const graph& G, const vec<vert_t>& xs, const vec<vert_t>& ys, const vert_t lb, const vert_t ub) {
+    assert(st.empty() && R_B.empty() && R_F.empty());
+    //backward search from xs; collects all verts in [lb,ub] that reach some vert in xs
+    for(const auto& x : xs) {
+        if(mark[x] != 0) continue;
+        mark[x] = 1;
+        st.push_back(x);
+    }
+    while(!st.empty()) {
+        const vert_t v = st.back();
+        st.pop_back();
+        R_B.push_back(v);
+        for(const auto& u : G.get_in_neighbour_range(v)) {
+            if(mark[u] != 0 || ord[u] < lb || ord[u] > ub) continue;
+            mark[u] = 1;
+            st.push_back(u);
+        }
+    }
+    //forward search from ys; collects all verts in [lb,ub] that are reachable from some vert in ys -- if one of them is in R_B, there is a cycle
+    bool acyclic = true;
+    for(const auto& y : ys) {
+        if(mark[y] == 1) { acyclic = false; break; }
+        if(mark[y] != 0) continue;
+        mark[y] = 2;
+        st.push_back(y);
+    }
+    while(acyclic && !st.empty()) {
+        const vert_t v = st.back();
+        st.pop_back();
+        R_F.push_back(v);
+        for(const auto& w : G.get_out_neighbour_range(v)) {
+            if(mark[w] == 1) { acyclic = false; break; }
+            if(mark[w] != 0 || ord[w] < lb || ord[w] > ub) continue;
+            mark[w] = 2;
+            st.push_back(w);
+        }
+    }
+    for(const auto& v : R_B) mark[v] = 0;
+    for(const auto& v : R_F) mark[v] = 0;
+    for(const auto& v : st) mark[v] = 0;
+    st.clear();
+
+    if(acyclic) {
+        //R_B is put in front of R_F, both keep their relative order; positions are taken from the ones R_B and R_F occupied before
+        const auto cmp = [this](const vert_t v, const vert_t w) { return ord[v] < ord[w]; };
+        std::sort(R_B.begin(), R_B.end(), cmp);
+        std::sort(R_F.begin(), R_F.end(), cmp);
+        slots.clear();
+        for(const auto& v : R_B) slots.push_back(ord[v]);
+        for(const auto& v : R_F) slots.push_back(ord[v]);
+        std::inplace_merge(slots.begin(), slots.begin()+R_B.size(), slots.end());
+        auto s_it = slots.begin();
+        for(const auto& v : R_B) set_pos(v, *(s_it++));
+        for(const auto& v : R_F) set_pos(v, *(s_it++));
+    }
+    R_B.clear();
+    R_F.clear();
+    return acyclic;
+};
+
+bool topo_order::repair(const graph& G, const vert_t c) {
+    //(1) out-edges c->w with ord[w] < ord[c]
+    xs.clear();
+    ys.clear();
+    vert_t lb = ord[c];
+    for(const auto& w : G.get_out_neighbour_range(c)) {
+        //self-loops are cycles
+        if(w == c) return false;
+        if(ord[w] > ord[c]) continue;
+        ys.push_back(w);
+        lb = std::min(lb, ord[w]);
+    }
+    if(!ys.empty()) {
+        xs.push_back(c);
+        if(!reorder(G, xs, ys, lb, ord[c])) return false;
+    }
+    //(2) in-edges u->c with ord[u] > ord[c]
+    xs.clear();
+    ys.clear();
+    vert_t ub = ord[c];
+    for(const auto& u : G.get_in_neighbour_range(c)) {
+        if(ord[u] < ord[c]) continue;
+        xs.push_back(u);
+        ub = std::max(ub, ord[u]);
+    }
+    if(!xs.empty()) {
+        ys.push_back(c);
+        if(!reorder(G, xs, ys, ord[c], ub)) return false;
+    }
+    return true;
+};
+
+bool topo_order::update(const graph& G) {
+    //only edges incident to merged verts can violate the order; place or repair them one after another
+    for(const auto& [v1,v2] : dirty) {
+        if(!valid) break;
+        const vert_t c = G.get_color(v1);
+        if(!G.is_active(c) || done[c]) continue;
+        const vert_t c_ = G.get_color(SIGMA(c));
+        done[c] = true;
+        done[c_] = true;
+        touched.push_back(c);
+        touched.push_back(c_);
+        //the in-edges of c are the skew-symmetric images of the out-edges of c_, and vice versa
+        out_c.clear();
+        for(const auto& w : G.get_out_neighbour_range(c)) out_c.push_back(w);
+        out_c_.clear();
+        if(c_ != c) for(const auto& w : G.get_out_neighbour_range(c_)) out_c_.push_back(w);
+        if(!place(G, c, v2, out_c, (c_ != c) ? out_c_ : out_c)) valid = repair(G, c);
+        if(valid && c_ != c && !place(G, c_, SIGMA(v2), out_c_, out_c)) valid = repair(G, c_);
+    }
+    for(const auto& v : touched) done[v] = false;
+    touched.clear();
+    dirty.clear();
+    assert( assert_data_structs(G) );
+    return valid;
+};
+
+vec<vert_t> topo_order::get_TO(const graph& G) const {
+    assert(valid);
+    vec<vert_t> to;
+    to.reserve( G.get_no_v() );
+    for(const auto& v : pos) {
+        if(G.is_active(v)) to.push_back(v);
+    }
+    assert(to.size() == G.get_no_v());
+    return to;
+};
+
+void topo_order::backtrack(topo_order_repr&& o_orig) noexcept {
+    while(trail.size() > o_orig.no_trail) {
+        const auto [v, p] = trail.back();
+        trail.pop_back();
+        ord[v] = p;
+        pos[p] = v;
+    }
+    valid = o_orig.valid;
+};
+
+bool topo_order::assert_data_structs(const graph& G) const noexcept {
+    assert(ord.size() == pos.size());
+    for(vert_t i = 0; i < pos.size(); ++i) assert(ord[pos[i]] == i);
+    if(!valid) return true;
+    for(const auto& v : G.get_v_range()) {
+        for([[maybe_unused]] const auto& w : G.get_out_neighbour_range(v)) assert(ord[v] < ord[w]);
+    }
+    return true;
+};
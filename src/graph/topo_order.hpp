@@ -0,0 +1,217 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+
+#include "../misc.hpp"
+#include "graph.hpp"
+
+// struct that contains all information required for backtracking a topo_order
+struct topo_order_repr {
+  public:
+    //length of the trail
+    size_t no_trail;
+    //whether the order was valid
+    bool valid;
+
+    topo_order_repr(const size_t _no_trail = 0, const bool _valid = false) noexcept : no_trail(_no_trail), valid(_valid) {};
+};
+
+/**
+ * @brief dynamic topological order of the active verts of a graph that is maintained under vertex removals and merges
+ * @note merges are handled in batches: a merged vert is moved to the position of the vert merged into it if this respects all its edges; otherwise its violating edges are fixed Pearce-Kelly style, i.e., only the verts between their endpoints that are affected are reordered -- cycles created by merges are detected on the way
+ * @note all changes are recorded on a trail; backtracking to a topo_order_repr is in O(#changes since get_state())
+ */
+class topo_order {
+  private:
+    /**
+     * @brief ord[v] is position of vert v
+     */
+    vec<vert_t> ord;
+
+    /**
+     * @brief pos[i] is the vert at position i, i.e., pos is the inverse of ord
+     * @note inactive verts keep their positions
+     */
+    vec<vert_t> pos;
+
+    /**
+     * @brief true iff ord is a topological order of the active verts (up to the edges of merged verts before update()); false if a cycle was found or the order was not computed yet
+     */
+    bool valid = false;
+
+    /**
+     * @brief pairs of merged verts since the last update(); only edges incident to their colors might violate the order
+     */
+    vec< std::pair<vert_t,vert_t> > dirty;
+
+    /**
+     * @brief trail of pairs (v, ord[v]) with the previous position of v
+     */
+    vec< std::pair<vert_t,vert_t> > trail;
+
+    /**
+     * @brief helpers for merge() and the (partial) recomputation
+     */
+    vec<uint8_t> mark;
+    vec<bool> done;
+    vec<vert_t> touched;
+    vec<vert_t> in_deg;
+    vec<vert_t> out_c;
+    vec<vert_t> out_c_;
+    vec<vert_t> R;
+    vec<vert_t> R_B;
+    vec<vert_t> R_F;
+    vec<vert_t> xs;
+    vec<vert_t> ys;
+    vec<vert_t> st;
+    vec<vert_t> TO;
+    vec<vert_t> slots;
+
+    /**
+     * @brief sets position of v to p and records the previous position on the trail
+     */
+    inline void set_pos(const vert_t v, const vert_t p) noexcept {
+      if(ord[v] == p) return;
+      trail.emplace_back(v, ord[v]);
+      ord[v] = p;
+      pos[p] = v;
+    };
+
+    /**
+     * @brief tries to place color c s.t. all its edges respect the order, either at its current position or at the one of alt
+     * 
+     * @param G graph
+     * @param c active vert
+     * @param alt vert whose position c may take instead if alt is inactive, e.g., the vert that was merged into c
+     * @param out_c out-neighbours of c
+     * @param out_c_ out-neighbours of the color of SIGMA(c)
+     * @return true iff c could be placed
+     */
+    bool place(const graph& G, const vert_t c, const vert_t alt, const vec<vert_t>& out_c, const vec<vert_t>& out_c_);
+
+    /**
+     * @brief reorders verts s.t. all edges x->y with x in xs and y in ys respect the order (Pearce-Kelly); all other edges that respected the order before still do afterwards
+     * 
+     * @param G graph
+     * @param xs sources of violating edges
+     * @param ys targets of violating edges
+     * @param lb smallest position of a vert in ys
+     * @param ub largest position of a vert in xs
+     * @return false iff a cycle was found, i.e., some vert in ys reaches some vert in xs
+     */
+    bool reorder(const graph& G, const vec<vert_t>& xs, const vec<vert_t>& ys, const vert_t lb, const vert_t ub);
+
+    /**
+     * @brief repairs order around c, i.e., fixes all violating edges incident to c
+     * 
+     * @param G graph
+     * @param c active vert
+     * @return false iff a cycle through c was found
+     */
+    bool repair(const graph& G, const vert_t c);
+
+    /**
+     * @brief sorts the active verts at positions lb,...,ub topologically, using only these positions
+     * 
+     * @param G graph
+     * @param lb first position
+     * @param ub last position
+     * @return false iff there is a cycle among these verts
+     */
+    bool sort_range(const graph& G, const vert_t lb, const vert_t ub);
+
+  public:
+    topo_order() noexcept {};
+
+    ~topo_order() = default;
+
+    /**
+     * @brief computes a topological order of G from scratch and clears the trail
+     * 
+     * @param G graph
+     * @return true iff G is a DAG
+     */
+    bool init(const graph& G);
+
+    /**
+     * @brief recomputes the topological order of G from scratch; all changes are recorded on the trail
+     * 
+     * @param G graph
+     * @return true iff G is a DAG
+     * @note runs in O(no_v+no_e); use after modifications of G that are not tracked via merge(), e.g., the merging of SCCs
+     */
+    bool recompute(const graph& G);
+
+    /**
+     * @brief notifies the order that merge_verts(v1,v2) has been called on G; does nothing if the order is not valid
+     * 
+     * @param G graph
+     * @param v1 first arg of merge_verts
+     * @param v2 second arg of merge_verts
+     * @note update() must be called after a batch of merges; the removal of verts does not require an update
+     */
+    void merge(const graph& G, const vert_t v1, const vert_t v2);
+
+    /**
+     * @brief repairs the order after a batch of merges
+     * 
+     * @param G graph
+     * @return true iff order is still valid, i.e., no cycle was created by the merges
+     * @note runs in O(#merged verts + their degrees) if no reordering is necessary
+     */
+    bool update(const graph& G);
+
+    /**
+     * @brief checks whether the order is valid, i.e., whether G is known to be a DAG
+     */
+    inline bool is_valid() const noexcept { assert(dirty.empty()); return valid; };
+
+    /**
+     * @brief Get the topological order of the active verts of G
+     * 
+     * @param G graph
+     * @return vec<vert_t> active verts of G in topological order
+     * @note order must be valid; runs in O(G.get_no_v_total())
+     */
+    vec<vert_t> get_TO(const graph& G) const;
+
+    /**
+     * @brief get the a representation of the order that allows backtracking
+     */
+    inline topo_order_repr get_state() const noexcept { assert(dirty.empty()); return topo_order_repr(trail.size(), valid); };
+
+    /**
+     * @brief backtrack to order represented by o_orig
+     * 
+     * @param o_orig representation of order to backtrack to
+     */
+    void backtrack(topo_order_repr&& o_orig) noexcept;
+
+    /**
+     * @brief assert that ord and pos are consistent, and that ord is a topological order of G if it is valid
+     * 
+     * @return true iff no checks fail; otherwise throws an assertion exception
+     */
+    bool assert_data_structs(const graph& G) const noexcept;
+};
@@ -0,0 +1,77 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <array>
+#include <stdint.h>
+
+#include "../misc.hpp"
+
+/**
+ * @brief set of marks over {0,...,n-1} that is cleared in O(1) by advancing a generation counter
+ */
+class epoch_marks {
+  private:
+    //i is marked iff stamp[i] == ep
+    vec<unsigned> stamp;
+    unsigned ep = 0;
+
+  public:
+    /**
+     * @brief unmarks all indices and makes sure that indices in {0,...,n-1} can be marked
+     * 
+     * @param n number of indices
+     * @note amortized O(1) (O(n) on growth or on overflow of the generation counter)
+     */
+    inline void clear(const size_t n) noexcept {
+      if(stamp.size() < n) stamp.resize(n, 0);
+      if(++ep == 0) {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        ep = 1;
+      }
+    };
+
+    inline bool is_marked(const size_t i) const noexcept { return stamp[i] == ep; };
+
+    inline void mark(const size_t i) noexcept { stamp[i] = ep; };
+
+    inline void unmark(const size_t i) noexcept { stamp[i] = ep-1; };
+};
+
+/**
+ * @brief workspace for graph traversals; avoids allocations and O(n) clears of visited-arrays for each traversal
+ * @note members are usually indexed by IL[v]; a traversal must not call another traversal that uses the same members, e.g., get_TO() uses scr[0]
+ * @note not thread-safe
+ */
+struct traversal_ws {
+  //independent sets of marks
+  std::array<epoch_marks, 2> mark;
+  //per-vert scratch arrays; they have to be initialized by the traversal (e.g. via assign, which does not reallocate)
+  std::array<vec<vert_t>, 4> scr;
+  std::array<vec<int>, 2> iscr;
+  std::array<vec<unsigned>, 2> uscr;
+  vec<uint8_t> bscr;
+  //stacks and queues (vectors with separate head idx)
+  std::array<vec<vert_t>, 2> st;
+  vec< std::pair<vert_t, size_t> > frames;
+};
@@ -23,6 +23,7 @@
 #include <queue>
 #include <omp.h>
 #include <stdexcept>
+#include <array>
 
 #include "robin_hood-3.11.5/robin_hood.h"
 #include "impl_graph.hpp"
@@ -41,16 +42,17 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
         xsys_stack = std::list< std::list<LinEqs> >();
         //init maps
         vl_stack = std::stack< vert_label_repr >();
+        to_stack = std::stack< topo_order_repr >();
     #ifndef FULL_REDUCTION
         //init assignments
         assignments = vec<lineral>(opt.num_vars+1, lineral());
     #endif
 
-        auto E = vec< std::pair<var_t,var_t> >();
+        auto E = vec< std::pair<vert_t,vert_t> >();
         E.reserve( (opt.ext==constr::extended ? 2 : 6) * clss.size() );
 
         //current number of verts
-        var_t no_v = 0;
+        vert_t no_v = 0;
 
         //init stacks
         vl = vert_label(clss.size()* (opt.ext==constr::extended ? 6 : 2), opt.num_vars);
@@ -85,15 +87,16 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
             {
                 if(vl.V_contains(l)) continue;
                 if(l.has_constant()) l.add_one();
+                if(no_v > std::numeric_limits<vert_t>::max() - 2) throw std::runtime_error("too many vertices for "+std::to_string(VERT_T_BITS)+"-bit vertex ids; increase VERT_T_BITS!");
                 auto ins = vl.insert(no_v, std::move(l), 0);
                 no_v += ins.inserted ? 2 : 0;
             }
             //note: f*g = (f+g+1)*f = (f+g+1)*g, i.e. add edges:
             //now add edges: fp1 -> g; fpg -> f; fpg -> g   (symmetric edges are then constructed from sigma!)
-            E.push_back( std::pair<var_t,var_t>( vl.V(fp1), vl.V(g) ) );
+            E.push_back( std::pair<vert_t,vert_t>( vl.V(fp1), vl.V(g) ) );
             if(opt.ext==constr::extended) {
-                E.push_back( std::pair<var_t,var_t>( vl.V(fpg), vl.V(f) ) );
-                E.push_back( std::pair<var_t,var_t>( vl.V(fpg), vl.V(g) ) );
+                E.push_back( std::pair<vert_t,vert_t>( vl.V(fpg), vl.V(f) ) );
+                E.push_back( std::pair<vert_t,vert_t>( vl.V(fpg), vl.V(g) ) );
             }
         }
 
@@ -115,6 +118,8 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
         xsys_stack.push_back( std::list<LinEqs>({ LinEqs(_L) }) );
         vl_stack.push( vl.get_state() );
         graph_stack.push( get_state() );
+        to.init( *this );
+        to_stack.push( to.get_state() );
 
         //init activity_score, based on number of occurances as LTs
         activity_score = vec<unsigned int>(opt.num_vars+1, 1);
@@ -136,10 +141,12 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
         clss = to_xcls(); //TODO inefficient!
         //compute topological order of graph
         const auto TO = get_TO();
+        //graph is not a DAG, i.e., linsys is inconsistent and no edges can be deduced
+        if(TO.empty()) continue;
     
         vec<LinEqs> D(no_v);
         for (auto v_it = TO.rbegin(); v_it != TO.rend(); ++v_it) {
-            var_t v = *v_it;
+            vert_t v = *v_it;
             const lineral f = vl.Vxlit(v);
             D[IL[v]] += LinEqs(f);
             for (const auto &w : get_in_neighbour_range(v)) D[IL[w]] += D[IL[v]];
@@ -147,16 +154,19 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
         }
         //add new edges
         const auto roots = get_roots();
-        var_t c_new_edges = 0;
+        //reachability index of current DAG; answers is_descendant(r1, SIGMA(r2)) in O(1)
+        const reach_index RI(*this, TO, vec<vert_t>(roots.begin(), roots.end()));
+        edge_cnt_t c_new_edges = 0;
         for(const auto& r1 : roots) {
             for(const auto& r2 : roots) {
                 if(r1==r2) continue;
+                if(RI.is_descendant(r1, SIGMA(r2))) continue;
                 const LinEqs tmp = D[IL[r1]] + D[IL[r2]];
                 if(tmp.is_consistent()) continue;
                 //const auto& [b,a] = intersectaffineVS(D[IL[r1]], D[IL[r2]]);
                 //if(!b) continue;
-                if(is_descendant(r1, SIGMA(r2))) continue;
                 repeat = true;
+                ++c_new_edges;
                 clss.emplace_back( vec<lineral>({vl.Vxlit(SIGMA(r1)), vl.Vxlit(SIGMA(r2))}) );
             }
         }
@@ -165,7 +175,7 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
     } while(repeat);
 };
 
-#ifdef USE_TRIE
+#if defined(USE_TRIE) || defined(USE_HCONS)
     LinEqs impl_graph::update_graph(stats& s, const LinEqs& L) {
         return update_graph_hash_fight_dev(s,L);
     };
@@ -174,6 +184,29 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
         return update_graph(s,L);
     };
     
+    //verts whose labels are reduced in an update
+    vec<vert_t> upd_verts;
+    const vec<vert_t>& impl_graph::get_upd_verts(const LinEqs& L) {
+        upd_verts.clear();
+        std::size_t no_occ = 0;
+        for(const auto& [lt,_] : L.get_pivot_poly_idx()) no_occ += vl.get_occ(lt).size();
+        if(no_occ >= no_v) {
+            //visiting all verts is cheaper than collecting and sorting the affected ones
+            for(const auto& v : get_v_range()) upd_verts.push_back(v);
+            return upd_verts;
+        }
+        for(const auto& [lt,_] : L.get_pivot_poly_idx()) {
+            for(const auto& v : vl.get_occ(lt)) {
+                //occurrence lists may contain verts that were removed or merged in the meantime
+                if(is_active(v) && vl.contains(v)) upd_verts.push_back(v);
+            }
+        }
+        //keep order of get_v_range(), as it determines which verts are merged into which
+        std::sort(upd_verts.begin(), upd_verts.end(), [this](const vert_t v, const vert_t w) { return IL[v] < IL[w]; });
+        upd_verts.erase( std::unique(upd_verts.begin(), upd_verts.end()), upd_verts.end() );
+        return upd_verts;
+    };
+
     //one global var for lineral lit, reduces memory allocations
     lineral lit;
     LinEqs impl_graph::update_graph_hash_fight(stats& s, const LinEqs& L) {
@@ -190,10 +223,17 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
         // (1) in parallel: reduce all lits and create new map Vxlit (linerals -> verts)
         // (2) sequentially: for each vertex v check whether 'V_stack.top().at( Vxlit(v) ) == v'; if not merge correspondingly!
     
-        std::list<std::pair<var_t,var_t> > merge_list;
+        //pairs (v_,v) s.t. v is merged into v_
+        vec< std::pair<vert_t,vert_t> > merge_list;
         //update current trie!
         //  -- (1) --
-        for (auto v : get_v_range()) {
+    #ifdef FULL_REDUCTION
+        //only labels that contain a pivot of L change
+        const auto& vs = get_upd_verts(L);
+    #else
+        const auto vs = get_v_range();
+    #endif
+        for (auto v : vs) {
         #ifdef FULL_REDUCTION
             if(!vl.contains(v)) continue;
             lit = std::move( vl.Vxlit(v) );
@@ -210,18 +250,20 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
                 s.no_vert_upd++;
                 //insert reduced lit in new_trie
                 auto [v_upd,b] = vl.update(v, lit, get_dl());
-                if( v_upd != v) merge_list.push_back( std::pair<var_t,var_t>{v, b ? SIGMA(v_upd) : v_upd} );
+                if( v_upd != v) merge_list.emplace_back( b ? SIGMA(v_upd) : v_upd, v );
             }
         }
     
         // -- (2) --
-        for (const auto &[v, v_] : merge_list) merge_verts(v_, v);
+        merge_verts(merge_list);
+        for (const auto &[v_, v] : merge_list) to.merge(*this, v_, v);
+        to.update(*this);
     
         //check if we can deduce linerals: i.e. check for literal '0'
         const auto [has_zero,is_one,v_] = vl.if_exists_get_zero_v();
         if(has_zero) {
             //flip if v_zero is actually vertex for 1 (!)
-            var_t v_zero = is_one ? SIGMA(v_) : v_;
+            vert_t v_zero = is_one ? SIGMA(v_) : v_;
             for (const auto &v : get_out_neighbour_range( v_zero )) {
                 new_L.push_back( vl.Vxlit(v) );
             #ifndef FULL_REDUCTION
@@ -257,10 +299,17 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
         // (1) in parallel: reduce all lits and create new map Vxlit (linerals -> verts)
         // (2) sequentially: for each vertex v check whether 'V_stack.top().at( Vxlit(v) ) == v'; if not merge correspondingly!
     
-        std::list<std::pair<var_t,var_t> > merge_list;
+        //pairs (v_,v) s.t. v is merged into v_
+        vec< std::pair<vert_t,vert_t> > merge_list;
         //update current trie!
         //  -- (1) --
-        for (auto v : get_v_range()) {
+    #ifdef FULL_REDUCTION
+        //only labels that contain a pivot of L change
+        const auto& vs = get_upd_verts(L);
+    #else
+        const auto vs = get_v_range();
+    #endif
+        for (auto v : vs) {
         #ifdef FULL_REDUCTION
             if(!vl.contains(v)) continue;
             lit = std::move( vl.Vxlit(v) );
@@ -270,7 +319,7 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
                 s.no_vert_upd++;
                 //insert reduced lit in new_trie
                 auto [v_upd,b] = vl.update(v, lit, get_dl());
-                if( v_upd != v) merge_list.push_back( std::pair<var_t,var_t>{v, b ? SIGMA(v_upd) : v_upd} );
+                if( v_upd != v) merge_list.emplace_back( b ? SIGMA(v_upd) : v_upd, v );
             }
         #else
             if(!vl.contains(v) || assignments[vl.Vxlit_LT(v)].is_zero()) continue;
@@ -284,30 +333,33 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
             //insert reduced lit in new_trie
             auto [v_upd,b] = vl.update(v, lit, get_dl());
             if( v_upd != v) {
-                merge_list.emplace_back( v, b ? SIGMA(v_upd) : v_upd );
-                assert( lit == vl.Vxlit(merge_list.back().second) );
+                merge_list.emplace_back( b ? SIGMA(v_upd) : v_upd, v );
+                assert( lit == vl.Vxlit(merge_list.back().first) );
             }
         #endif
         }
     
         // -- (2) --
-        for (const auto &[v, v_] : merge_list) merge_verts(v_, v);
+        merge_verts(merge_list);
+        for (const auto &[v_, v] : merge_list) to.merge(*this, v_, v);
+        to.update(*this);
     
         //check if we can deduce linerals: i.e. check for literal '0'
         const auto [has_zero,is_one,v_] = vl.if_exists_get_zero_v();
         if(has_zero) {
             //flip if v_zero is actually vertex for 1 (!)
-            var_t v_zero = is_one ? SIGMA(v_) : v_;
-            //collect all linerals reachable by v_zero
-            robin_hood::unordered_flat_set<var_t> marked;
-            std::list<var_t> q;
+            vert_t v_zero = is_one ? SIGMA(v_) : v_;
+            //collect all linerals reachable by v_zero (marks are indexed by vert, as IL changes when verts are removed)
+            auto& marked = ws.mark[0];
+            auto& q = ws.st[0];
+            marked.clear( get_no_v_total() );
+            q.clear();
             q.push_back( v_zero );
-            marked.insert( v_zero );
-            while(!q.empty()) {
-                const auto v = q.front();
-                q.pop_front();
+            marked.mark( v_zero );
+            for(std::size_t q_head = 0; q_head < q.size(); ++q_head) {
+                const auto v = q[q_head];
                 //get corr lineral -- if SIGMA(v) is marked this means that l AND l+1 are implied, i.e., add 1 to new_L (!)
-                if(marked.contains(SIGMA(v))) {
+                if(marked.is_marked(SIGMA(v))) {
                     new_L.push_back( lineral(cnst::one) );
                     break;
                 }
@@ -319,9 +371,9 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
             #endif
                 //put children in queue - if not yet marked
                 for (const auto &w : get_out_neighbour_range( v )) {
-                    if(!marked.contains(w)) {
+                    if(!marked.is_marked(w)) {
                         q.push_back(w);
-                        marked.insert(w); //ensure that w can only appears once in q
+                        marked.mark(w); //ensure that w can only appears once in q
                     }
                 }
                 //remove vertex!
@@ -350,10 +402,10 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
         // (1) in parallel: reduce all lits and create new map Vxlit (linerals -> verts)
         // (2) sequentially: for each vertex v check whether 'V_stack.top().at( Vxlit(v) ) == v'; if not merge correspondingly!
 
-        vec<std::pair< var_t,var_t> > merge_vec(no_v);
+        vec<std::pair< vert_t,vert_t> > merge_vec(no_v);
         //compute new V and Vxlit
-        hmap<lineral, var_t> new_V(no_v/10);
-        hmap<var_t, lineral> new_Vxlit(no_v/10);
+        hmap<lineral, vert_t> new_V(no_v/10);
+        hmap<vert_t, lineral> new_Vxlit(no_v/10);
         //  -- (1) -- parallel
         //#pragma omp parallel for
         for (auto v : get_v_range()) { //TODO update v then update SIGMA(v) based on v --> saves half the time!
@@ -380,11 +432,15 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
                 [[maybe_unused]] auto inserted2 = new_Vxlit.emplace( v, std::move(lit) ); 
                 assert(inserted2.second);
             }
-            merge_vec[ IL[v] ] = std::pair<var_t,var_t>{v, inserted.second ? v : (inserted.first)->second};
+            merge_vec[ IL[v] ] = std::pair<vert_t,vert_t>{v, inserted.second ? v : (inserted.first)->second};
         }
 
         // -- (2) -- sequential
-        for (const auto &[v, v_] : merge_vec) merge_verts(v_, v);
+        vec< std::pair<vert_t,vert_t> > merge_list;
+        for (const auto &[v, v_] : merge_vec) if(v != v_) merge_list.emplace_back(v_, v);
+        merge_verts(merge_list);
+        for (const auto &[v_, v] : merge_list) to.merge(*this, v_, v);
+        to.update(*this);
 
         //check if we can deduce linerals: i.e. check for literal '0'
         const auto search = new_V.find( lineral() );
@@ -402,16 +458,97 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
             new_V.erase( search );
         }
         
-        vl.put_Vxlit( std::move(new_Vxlit) );
-        vl.put_V( std::move(new_V) );
+        vl.put( std::move(new_Vxlit), std::move(new_V) );
 
         assert( assert_data_structs() );
 
         return std::move( LinEqs(std::move(new_L)) );
     };
 
+    #define NO_VERT ((vert_t) -1)
+
     LinEqs impl_graph::update_graph_par(stats& s, const LinEqs& L) {
-        return std::move( update_graph(s,L) );
+        assert( L.is_consistent() );
+        auto new_L = vec<lineral>();
+        if(L.size() == 0) return std::move( LinEqs(std::move(new_L)) );
+
+        //update in three steps:
+        // (1) in parallel: reduce all lits and insert them in a concurrent map new_V (linerals -> verts); of equal linerals the one of the vert that comes first in get_v_range() is kept (as in update_graph)
+        // (2) in parallel: look up the kept vert of each lit, and create new map Vxlit
+        // (3) sequentially: merge verts
+
+        const auto v_range = get_v_range();
+        //prio[v] is the position in v_range of the vert whose lit is stored at v
+        vec<vert_t> prio( get_no_v_total() );
+        //lits[i] is the reduced lit of v_range[i], and verts[i] the vert it is stored at (or NO_VERT if v_range[i] has no lit)
+        vec<lineral> lits(no_v);
+        vec<vert_t> verts(no_v);
+        vl_conc new_V(no_v/10, prio);
+        //  -- (1) -- parallel
+        unsigned long no_vert_upd = 0;
+        #pragma omp parallel for schedule(static) reduction(+:no_vert_upd)
+        for(vert_t i = 0; i < no_v; ++i) {
+            vert_t v = v_range[i];
+            if(!vl.Vxlit_if_contains_unsafe(v, lits[i])) { verts[i] = NO_VERT; continue; }
+            //reduce with linsys
+            #ifdef FULL_REDUCTION
+                const bool update_req = lits[i].reduce( L );
+            #else
+                const bool update_req = lits[i].lt_reduce( assignments );
+            #endif
+            if(lits[i].has_constant()) {
+                //flip lit and v
+                v = SIGMA(v);
+                lits[i].add_one();
+            }
+            if(update_req) no_vert_upd++;
+            verts[i] = v;
+            prio[v] = i;
+            new_V.insert(v, lits[i]);
+        }
+        s.no_vert_upd += no_vert_upd;
+
+        //  -- (2) -- parallel
+        vec<std::pair< vert_t,vert_t> > merge_vec(no_v);
+        hmap<vert_t, lineral> new_Vxlit(no_v/10);
+        #pragma omp parallel for schedule(static)
+        for(vert_t i = 0; i < no_v; ++i) {
+            const vert_t v = verts[i];
+            if(v == NO_VERT) continue;
+            const vert_t v_ = new_V.at( lits[i] );
+            merge_vec[ IL[v] ] = std::pair<vert_t,vert_t>{v, v_};
+            if(v == v_) new_Vxlit.emplace( v, std::move(lits[i]) );
+        }
+        hmap<lineral, vert_t> new_V_ = new_V.extract();
+
+        // -- (3) -- sequential
+        vec< std::pair<vert_t,vert_t> > merge_list;
+        for (const auto &[v, v_] : merge_vec) if(v != v_) merge_list.emplace_back(v_, v);
+        merge_verts(merge_list);
+        for (const auto &[v_, v] : merge_list) to.merge(*this, v_, v);
+        to.update(*this);
+
+        //check if we can deduce linerals: i.e. check for literal '0'
+        const auto search = new_V_.find( lineral() );
+        if( search != new_V_.end() ) { //0-literal found!
+            for (const auto &v : get_out_neighbour_range( search->second )) {
+                new_L.push_back( new_Vxlit.contains(v) ? new_Vxlit.at(v) : new_Vxlit.at(SIGMA(v)).plus_one() );
+            #ifndef FULL_REDUCTION
+                new_L.back().reduce(assignments);
+            #endif
+            }
+            //remove vertex!
+            remove_vert( search->second );
+            //remove lit/v from new_Vxlit and new_V_ (!)
+            new_Vxlit.erase( search->second );
+            new_V_.erase( search );
+        }
+        
+        vl.put( std::move(new_Vxlit), std::move(new_V_) );
+
+        assert( assert_data_structs() );
+
+        return std::move( LinEqs(std::move(new_L)) );
     };
 
     LinEqs impl_graph::update_graph_hash_fight(stats& s, const LinEqs& L) {
@@ -426,62 +563,224 @@ impl_graph::impl_graph(const vec< vec<lineral> >& clss_, const options& opt_) :
 
 
 //implication graph analysis!
-// C++ Implementation of Kosaraju's algorithm to print all SCCs -- adapted from 'https://www.geeksforgeeks.org/strongly-connected-components/'
-void impl_graph::scc_fillOrder(const var_t v, vec<bool>& visited, std::stack<var_t> &Stack) const {
-    // Mark the current node as visited and print it
-    visited[IL[v]] = true;
-    // Recur for all the vertices adjacent to this vertex
-    for (const auto &w : get_out_neighbour_range(v)) {
-        if(!visited[IL[w]]) scc_fillOrder(w, visited, Stack);
-    }
-    // All vertices reachable from v are processed by now, push v
-    Stack.push(v);
-}
+//iterative Tarjan; neighbours of the verts on the call stack are kept on a common stack nbrs
+void impl_graph::scc_tarjan(vec< std::pair<vert_t,vert_t> >& merge_list, vec<vert_t>& failing_v) const {
+    //DFS index and lowlink of each vert (indexed by IL), index 0 means unvisited
+    auto& idx = ws.uscr[0];
+    auto& low = ws.uscr[1];
+    idx.assign(no_v, 0);
+    low.resize(no_v);
+    auto& on_stack = ws.mark[0];
+    on_stack.clear(no_v);
+    //marks verts whose SCC was already found
+    auto& done = ws.mark[1];
+    done.clear(no_v);
+    //root of DFS tree that discovered vert (indexed by IL)
+    auto& tree_rt = ws.scr[0];
+    tree_rt.resize(no_v);
+    //stack of Tarjan's algorithm
+    auto& S = ws.st[0];
+    S.clear();
+    //DFS call stack; (v,b) where nbrs[b:] are the unprocessed out-neighbours of v (if v is on top)
+    auto& call_st = ws.frames;
+    call_st.clear();
+    auto& nbrs = ws.st[1];
+    nbrs.clear();
+    unsigned cnt = 0;
+
+    merge_list.clear();
+    failing_v.clear();
+
+    auto visit = [&](const vert_t v, const vert_t r) {
+        idx[IL[v]] = low[IL[v]] = ++cnt;
+        tree_rt[IL[v]] = r;
+        //v and SIGMA(v) are reachable from r
+        if(idx[IL[SIGMA(v)]] > 0 && tree_rt[IL[SIGMA(v)]] == r) failing_v.push_back(v);
+        S.push_back(v);
+        on_stack.mark(IL[v]);
+        call_st.emplace_back(v, nbrs.size());
+        for(const auto &w : get_out_neighbour_range(v)) nbrs.push_back(w);
+    };
+
+    auto dfs = [&](const vert_t r) {
+        visit(r, r);
+        while(!call_st.empty()) {
+            const auto [v, b] = call_st.back();
+            if(nbrs.size() > b) {
+                const vert_t w = nbrs.back();
+                nbrs.pop_back();
+                if(idx[IL[w]] == 0) visit(w, r);
+                else if(on_stack.is_marked(IL[w])) low[IL[v]] = std::min(low[IL[v]], idx[IL[w]]);
+                continue;
+            }
+            //all out-neighbours of v processed
+            call_st.pop_back();
+            if(!call_st.empty()) low[IL[call_st.back().first]] = std::min(low[IL[call_st.back().first]], low[IL[v]]);
+            if(low[IL[v]] != idx[IL[v]]) continue;
+            //v is root of an SCC; skip it if its symmetric SCC was already found
+            const bool add = !done.is_marked(IL[SIGMA(v)]);
+            vert_t w;
+            do {
+                w = S.back();
+                S.pop_back();
+                on_stack.unmark(IL[w]);
+                done.mark(IL[w]);
+                if(add && w != v) merge_list.emplace_back(v, w);
+            } while(w != v);
+        }
+    };
 
-// A recursive function to print reverse DFS starting from v (with root rt), i.e., in transpose graph and reading visited-vector negated
-void impl_graph::scc_dfs_util(const var_t rt, vec<lineral>& linerals, var_t v, vec<bool>& visited, std::list< std::pair<var_t,var_t> >& merge_list) const {
-    // Mark the current node as visited and print it
-    visited[IL[v]] = false;
-    if(v!=rt) {
-        linerals.emplace_back( std::move( Vxlit_sum(rt,v) ) );
-        merge_list.emplace_back( rt, v );
+    //start from roots first, such that failing_v corresponds to fls_trivial
+    for(const auto &v : get_v_range()) {
+        if(idx[IL[v]] == 0 && get_in_degree(v) == 0) dfs(v);
     }
-    // Recur for all the vertices in-coming to this vertex
-    for (const auto &&w : get_in_neighbour_range(v)) {
-        if (visited[IL[w]]) scc_dfs_util(rt, linerals, w, visited, merge_list);
+    for(const auto &v : get_v_range()) {
+        if(idx[IL[v]] == 0) dfs(v);
     }
 }
 
-// The main function that finds and prints all strongly connected
-// components
-// TODO rewrite complete tarjans algorithm to also check for trivial FLS ?
-vec<lineral> linerals;
-vec<lineral> out;
-LinEqs impl_graph::scc_analysis() {
-    std::stack<var_t> Stack;
+#define SCC_DONE 1
+#define SCC_FW 2
+#define SCC_BW 4
+
+//forward-backward SCC decomposition with trimming; partitions are processed in parallel rounds
+void impl_graph::scc_fwbw(vec< std::pair<vert_t,vert_t> >& merge_list) const {
+    //root of SCC of each vert (indexed by IL)
+    auto& rt = ws.scr[0];
+    rt.resize(no_v);
+    //state of each vert (indexed by IL), combination of SCC_DONE, SCC_FW and SCC_BW
+    auto& state = ws.bscr;
+    state.assign(no_v, 0);
+    //partition of each vert (indexed by IL)
+    auto& part = ws.uscr[0];
+    part.assign(no_v, 0);
+
+    //(1) trim: verts without in- or out-edges to remaining verts are trivial SCCs
+    auto& in_d = ws.scr[1];
+    auto& out_d = ws.scr[2];
+    in_d.resize(no_v);
+    out_d.resize(no_v);
+    auto& trimmed = ws.st[0];
+    trimmed.clear();
+    for(const auto &v : get_v_range()) {
+        in_d[IL[v]] = get_in_degree(v);
+        out_d[IL[v]] = get_out_degree(v);
+        if(in_d[IL[v]] == 0 || out_d[IL[v]] == 0) {
+            state[IL[v]] = SCC_DONE;
+            trimmed.push_back(v);
+        }
+    }
+    for(vert_t i = 0; i < trimmed.size(); ++i) {
+        const vert_t v = trimmed[i];
+        rt[IL[v]] = v;
+        for(const auto &w : get_out_neighbour_range(v)) {
+            if(!state[IL[w]] && --in_d[IL[w]] == 0) { state[IL[w]] = SCC_DONE; trimmed.push_back(w); }
+        }
+        for(const auto &w : get_in_neighbour_range(v)) {
+            if(!state[IL[w]] && --out_d[IL[w]] == 0) { state[IL[w]] = SCC_DONE; trimmed.push_back(w); }
+        }
+    }
+
+    //(2) forward-backward on remaining partitions
+    vec< vec<vert_t> > parts(1);
+    for(const auto &v : get_v_range()) if(!state[IL[v]]) parts[0].push_back(v);
+    if(parts[0].empty()) parts.clear();
+    unsigned next_id = 1;
+    while(!parts.empty()) {
+        //split each partition S into SCC of pivot, fw-reachable verts, bw-reachable verts and remaining verts
+        vec< std::array< vec<vert_t>, 3 > > split( parts.size() );
+        #pragma omp parallel for schedule(dynamic,1)
+        for(std::size_t k = 0; k < parts.size(); ++k) {
+            const auto& S = parts[k];
+            const unsigned pid = part[IL[S[0]]];
+            const vert_t p = S[0];
+            if(S.size() == 1) { rt[IL[p]] = p; state[IL[p]] = SCC_DONE; continue; }
+
+            //forward search
+            vec<vert_t> st({p});
+            state[IL[p]] |= SCC_FW;
+            while(!st.empty()) {
+                const vert_t v = st.back();
+                st.pop_back();
+                for(const auto &w : get_out_neighbour_range(v)) {
+                    if(part[IL[w]] == pid && !(state[IL[w]] & (SCC_FW|SCC_DONE))) { state[IL[w]] |= SCC_FW; st.push_back(w); }
+                }
+            }
+            //backward search
+            st.push_back(p);
+            state[IL[p]] |= SCC_BW;
+            while(!st.empty()) {
+                const vert_t v = st.back();
+                st.pop_back();
+                for(const auto &w : get_in_neighbour_range(v)) {
+                    if(part[IL[w]] == pid && !(state[IL[w]] & (SCC_BW|SCC_DONE))) { state[IL[w]] |= SCC_BW; st.push_back(w); }
+                }
+            }
+
+            //SCC of p
+            for(const auto &v : S) {
+                if((state[IL[v]] & (SCC_FW|SCC_BW)) == (SCC_FW|SCC_BW)) { rt[IL[v]] = p; state[IL[v]] = SCC_DONE; }
+            }
+            //SCC of SIGMA(p) is symmetric to SCC of p; as SCCs are never split, it is completely contained in S if SIGMA(p) is
+            if(part[IL[SIGMA(p)]] == pid && !(state[IL[SIGMA(p)]] & SCC_DONE)) {
+                for(const auto &v : S) {
+                    if(rt[IL[v]] == p && state[IL[v]] == SCC_DONE) { rt[IL[SIGMA(v)]] = SIGMA(p); state[IL[SIGMA(v)]] = SCC_DONE; }
+                }
+            }
+            for(const auto &v : S) {
+                if(state[IL[v]] & SCC_DONE) continue;
+                if(state[IL[v]] & SCC_FW) split[k][0].push_back(v);
+                else if(state[IL[v]] & SCC_BW) split[k][1].push_back(v);
+                else split[k][2].push_back(v);
+                state[IL[v]] = 0;
+            }
+        }
 
-    // Mark all the vertices as not visited (For first DFS)
-    vec<bool> visited( no_v, false );
+        //relabel partitions (in a separate loop, such that no vert changes its partition while others are searching)
+        vec< vec<vert_t> > parts_;
+        for(auto& sp : split) {
+            for(auto& S : sp) {
+                if(S.empty()) continue;
+                parts_.emplace_back( std::move(S) );
+            }
+        }
+        #pragma omp parallel for schedule(dynamic,16)
+        for(std::size_t k = 0; k < parts_.size(); ++k) {
+            for(const auto &v : parts_[k]) part[IL[v]] = next_id + k;
+        }
+        next_id += parts_.size();
+        std::swap(parts, parts_);
+    }
 
-    // Fill vertices in stack according to their finishing times
-    for (const auto &w : get_v_range()) {
-        if(visited[IL[w]] == false) scc_fillOrder(w, visited, Stack);
+    //(3) generate merge_list -- only for one SCC of each symmetric pair
+    merge_list.clear();
+    for(const auto &v : get_v_range()) {
+        const vert_t r = rt[IL[v]];
+        if(r == v) continue;
+        const vert_t r_ = rt[IL[SIGMA(r)]];
+        if(r <= r_) merge_list.emplace_back(r, v);
     }
+}
 
+vec<lineral> linerals;
+vec<lineral> out;
+LinEqs impl_graph::scc_analysis(const vert_t par_thresh) {
     //new linerals:
     linerals.clear();
-    std::list< std::pair<var_t,var_t> > merge_list;
-    // Now process all vertices in order defined by Stack
-    while (Stack.empty() == false) {
-        // Pop a vertex from stack
-        const var_t v = Stack.top();
-        Stack.pop();
-        // get SCC of v
-        if (visited[IL[v]] == true) {
-            scc_dfs_util(v, linerals, v, visited, merge_list);
-            //minor optimization to finding only one of each symmetrical components!
-            visited[IL[SIGMA(v)]] = false;
-        }
+    vec< std::pair<vert_t,vert_t> > merge_list;
+
+    if(no_v >= par_thresh) {
+        scc_fwbw(merge_list);
+        linerals.resize( merge_list.size() );
+        #pragma omp parallel for schedule(static)
+        for(std::size_t i = 0; i < merge_list.size(); ++i) linerals[i] = Vxlit_sum(merge_list[i].first, merge_list[i].second);
+        fls_trivial_v_valid = false;
+    } else {
+        scc_tarjan(merge_list, fls_trivial_v);
+        linerals.reserve( merge_list.size() );
+        for(const auto& [rt,v] : merge_list) linerals.emplace_back( Vxlit_sum(rt,v) );
+        //trivial fls can be reused if the graph is not modified
+        fls_trivial_v_valid = merge_list.empty();
     }
 
 #ifndef FULL_REDUCTION
@@ -496,12 +795,14 @@ LinEqs impl_graph::scc_analysis() {
     //merge nodes if scc is consistent!
     if(scc.is_consistent()) {
         //merge SCCs (and remove labels)
+        merge_verts(merge_list);
         for(const auto& [rt,v] : merge_list) {
-            merge_verts(rt, v);
             //erase label from vl
             if(vl.contains(v)) vl.erase(v);
             else if(vl.contains(SIGMA(v))) vl.erase(SIGMA(v)); 
         }
+        //merged SCCs are not tracked by to; recompute it as the graph might be a DAG again
+        if(!to.is_valid()) to.recompute(*this);
     }
 
     return scc;
@@ -510,19 +811,178 @@ LinEqs impl_graph::scc_analysis() {
 
 #define IS_MARKED(a,i) !(a[i]==L.size())
 
-vec<var_t> impl_graph::label_components() const {
+edge_cnt_t impl_graph::transitive_reduction(const vert_t exact_thresh, const vert_t budget) {
+    if(no_e == 0) return 0;
+    const auto TO = get_TO();
+    if(TO.empty()) return 0;
+    const edge_cnt_t no_e_before = no_e;
+
+    //pos[IL[v]] is the position of v in TO
+    auto& pos = ws.scr[1];
+    pos.resize(no_v);
+    for(vert_t i = 0; i < TO.size(); ++i) pos[IL[TO[i]]] = i;
+    //cc_size[IL[rt]] is the size of the connected comp with label rt
+    const auto label = label_components();
+    auto& cc_size = ws.scr[2];
+    cc_size.assign(no_v, 0);
+    for(const auto v : get_v_range()) ++cc_size[IL[label[IL[v]]]];
+
+    auto& reached = ws.mark[0];
+    auto& nbrs = ws.st[1];
+    auto& st = ws.st[0];
+    auto& redundant = ws.scr[3];
+    for(const auto u : TO) {
+        if(get_out_degree(u) < 2) continue;
+        //out-neighbours of u in topological order; the first one is never redundant
+        nbrs.clear();
+        std::ranges::copy(get_out_neighbour_range(u), std::back_inserter(nbrs));
+        std::sort(nbrs.begin(), nbrs.end(), [&](const vert_t a, const vert_t b){ return pos[IL[a]] < pos[IL[b]]; });
+        const vert_t max_pos = pos[IL[nbrs.back()]];
+        const bool exact = cc_size[IL[label[IL[u]]]] <= exact_thresh;
+        const vert_t nu = get_color(SIGMA(u));
+        vert_t visits = 0;
+        reached.clear(no_v);
+        redundant.clear();
+        for(const auto w : nbrs) {
+            //w is reachable from a kept out-neighbour of u, i.e., u->w is redundant
+            if(reached.is_marked(IL[w])) { redundant.push_back(w); continue; }
+            //mark descendants of w that precede the last out-neighbour of u in TO; nu is never entered, as all removed symmetric edges end in nu
+            st.clear();
+            st.push_back(w);
+            while(!st.empty() && (exact || visits < budget)) {
+                const vert_t v = st.back();
+                st.pop_back();
+                ++visits;
+                for(const auto n : get_out_neighbour_range(v)) {
+                    if(n == nu || pos[IL[n]] > max_pos || reached.is_marked(IL[n])) continue;
+                    reached.mark(IL[n]);
+                    st.push_back(n);
+                }
+            }
+        }
+        for(const auto w : redundant) {
+            [[maybe_unused]] const bool rm = erase_edge(u, w);
+            assert(rm);
+        }
+    }
+    assert( assert_data_structs() );
+    return no_e_before - no_e;
+}
+
+vert_t impl_graph::compact() {
+    assert(graph_stack.size() == 1 && vl_stack.size() == 1 && to_stack.size() == 1);
+    const vert_t no_v_total = get_no_v_total();
+    const auto deg = [this](const vert_t v) -> std::size_t { return (std::size_t) get_in_degree(v) + get_out_degree(v); };
+
+    //order contains the active verts in Cuthill-McKee order, each immediately followed by its symmetric vert; it is also used as queue
+    vec<vert_t> order;
+    order.reserve(no_v);
+    auto& visited = ws.mark[0];
+    visited.clear(no_v);
+    //visits v and SIGMA(v), the vert that stores the label (without constant) comes first
+    const auto visit = [&](const vert_t v) {
+        const vert_t v_ = get_color(SIGMA(v));
+        assert(v != v_);
+        visited.mark(IL[v]);
+        visited.mark(IL[v_]);
+        order.push_back( vl.contains(v) ? v : v_ );
+        order.push_back( vl.contains(v) ? v_ : v );
+    };
+    //start bfs of each comp in a vert of min degree
+    auto starts = get_v_vector();
+    std::stable_sort(starts.begin(), starts.end(), [&](const vert_t a, const vert_t b){ return deg(a) < deg(b); });
+    auto& nbrs = ws.st[1];
+    for(const auto rt : starts) {
+        if(visited.is_marked(IL[rt])) continue;
+        visit(rt);
+        for(std::size_t q_head = order.size()-2; q_head < order.size(); ++q_head) {
+            const vert_t v = order[q_head];
+            //visit unvisited neighbours by increasing degree
+            nbrs.clear();
+            for(const auto n : get_out_neighbour_range(v)) if(!visited.is_marked(IL[n])) nbrs.push_back(n);
+            for(const auto n : get_in_neighbour_range(v))  if(!visited.is_marked(IL[n])) nbrs.push_back(n);
+            std::stable_sort(nbrs.begin(), nbrs.end(), [&](const vert_t a, const vert_t b){ return deg(a) < deg(b); });
+            for(const auto n : nbrs) if(!visited.is_marked(IL[n])) visit(n);
+        }
+    }
+    assert(order.size() == no_v);
+
+    //k-th vert in order becomes vert k; note: reversing the order (RCM) was measured to be slower for our traversals
+    auto& new_v = ws.scr[1];
+    new_v.resize(no_v);
+    for(vert_t k = 0; k < no_v; ++k) new_v[IL[order[k]]] = k;
+
+    //new vertex labels
+    vert_label vl_new(no_v, opt.num_vars);
+    for(vert_t k = 0; k < no_v; k += 2) {
+        [[maybe_unused]] const auto ins = vl_new.insert(new_v[IL[order[k]]], vl.Vxlit(order[k]), 0);
+        assert(ins.inserted);
+    }
+    //new edges, only one of each pair of symmetric edges
+    auto E = vec< std::pair<vert_t,vert_t> >();
+    E.reserve(no_e);
+    for(const auto v : get_v_range()) {
+        for(const auto w : get_out_neighbour_range(v)) {
+            const vert_t src = new_v[IL[v]];
+            const vert_t dst = new_v[IL[w]];
+            if(std::make_pair(src, dst) <= std::make_pair(SIGMA(dst), SIGMA(src))) E.emplace_back(src, dst);
+        }
+    }
+    std::sort(E.begin(), E.end());
+    E.erase( std::unique(E.begin(), E.end()), E.end());
+
+    //rebuild graph, labels and topological order; the new state replaces the level-0 state
+    const vert_t no_v_new = no_v;
+    vl = std::move(vl_new);
+    init(E, no_v_new);
+    graph_stack = std::stack< graph_repr >();
+    graph_stack.push( get_state() );
+    vl_stack = std::stack< vert_label_repr >();
+    vl_stack.push( vl.get_state() );
+    to.init( *this );
+    to_stack = std::stack< topo_order_repr >();
+    to_stack.push( to.get_state() );
+    fls_trivial_v.clear();
+    fls_trivial_v_valid = false;
+    //free scratch space of the old graph
+    ws = traversal_ws();
+    assert( assert_data_structs() );
+
+    return no_v_total - no_v;
+}
+
+std::size_t impl_graph::gc_level0() {
+    assert(xsys_stack.size() == 1 && linsys.is_consistent());
+    auto& L0 = xsys_stack.front();
+    if(L0.size() > 1) {
+    #ifndef FULL_REDUCTION
+        for(const auto& L : L0) {
+            for(const auto& [lt,_] : L.get_pivot_poly_idx()) assignments[lt].reset();
+        }
+    #endif
+        //merge in order, such that the LTs of the merged system are those of the single systems
+        LinEqs merged = std::move(L0.front());
+        for(auto it = std::next(L0.begin()); it != L0.end(); ++it) merged += *it;
+        L0.clear();
+        add_new_xsys( std::move(merged) );
+    }
+    //the (stale) level-0 snapshot in vl_stack is never restored, as there is no backtracking below level 0
+    return vl.gc_due() ? vl.gc() : 0;
+}
+
+vec<vert_t> impl_graph::label_components() const {
     assert(no_v <= L.size());
     //construct map that maps vert number to root vert of same comp
-    vec<var_t> label(no_v, L.size());
+    vec<vert_t> label(no_v, L.size());
 
-    std::list<var_t> q;
+    auto& q = ws.st[0];
     for(const auto rt : get_v_range()) {
         if(IS_MARKED(label,IL[rt])) continue;
         //mark all verts reachable from rt via bfs
+        q.clear();
         q.push_back(rt);
-        while(!q.empty()) {
-            const auto v = q.front();
-            q.pop_front();
+        for(std::size_t q_head = 0; q_head < q.size(); ++q_head) {
+            const auto v = q[q_head];
             if(IS_MARKED(label,IL[v])) continue;
             label[IL[v]] = rt;
             for(const auto n : get_in_neighbour_range(v))  if(!IS_MARKED(label,IL[n])) q.push_back(n);
@@ -533,17 +993,17 @@ vec<var_t> impl_graph::label_components() const {
     return label;
 }
 
-var_t impl_graph::get_number_connected_components() const {
+vert_t impl_graph::get_number_connected_components() const {
     const auto label = label_components();
     //number of connected components is exactly number of v's with label[IL[v]] = v
-    var_t n_cc = 0;
+    vert_t n_cc = 0;
     for(const auto& v : get_v_range()) if(label[IL[v]] == v) n_cc++;
 
     return n_cc;
 }
 
-std::list<var_t> impl_graph::get_roots() const {
-    std::list<var_t> q_roots;
+std::list<vert_t> impl_graph::get_roots() const {
+    std::list<vert_t> q_roots;
     
     // initialize the queue with all the vertices with no inbound edges
     for (const auto &v : get_v_range()) {
@@ -554,27 +1014,31 @@ std::list<var_t> impl_graph::get_roots() const {
 }
 
 // computes a topological order of the graph; assertion failure if graph is no DAG (!)
-vec<var_t> impl_graph::get_TO() const {
-    std::queue<var_t> q_roots;
-    vec<var_t> in_degree_tmp(no_v);
+vec<vert_t> impl_graph::get_TO() const {
+    //use maintained TO if available
+    if(to.is_valid()) {
+        assert( to.assert_data_structs(*this) );
+        return to.get_TO(*this);
+    }
+    auto& in_degree_tmp = ws.scr[0];
+    in_degree_tmp.resize(no_v);
     
+    //to is used as queue: verts in to[q_head:] have in-degree 0 but were not yet 'removed'
+    vec<vert_t> to;
+    to.reserve( no_v );
     // initialize the queue with all the vertices with no inbound edges
     for (const auto &v : get_v_range()) {
         in_degree_tmp[IL[v]] = get_in_degree(v);
-        if( get_in_degree(v) == 0 ) q_roots.push(v);
+        if( get_in_degree(v) == 0 ) to.push_back(v);
     }
     
-    vec<var_t> to;
-    to.reserve( no_v );
-    while (!q_roots.empty()) {
-        const var_t v = q_roots.front();
-        q_roots.pop();
-        to.emplace_back(v);
+    for (std::size_t q_head = 0; q_head < to.size(); ++q_head) {
+        const vert_t v = to[q_head];
         // 'remove' v from the graph, by decreasing in_degree_tmp corr
         for (const auto &w : get_out_neighbour_range(v)) {
             --in_degree_tmp[IL[w]];
             if(in_degree_tmp[IL[w]] == 0) {
-                q_roots.push(w);
+                to.push_back(w);
             }
         }
     }
@@ -585,16 +1049,22 @@ vec<var_t> impl_graph::get_TO() const {
 } 
 
 
-bool impl_graph::is_descendant(const var_t src, const var_t dst) {
+bool impl_graph::is_descendant(const vert_t src, const vert_t dst) const {
     if(src==dst) return true;
-    std::list<var_t> queue;
-    queue.push_back(src);
-    while(!queue.empty()) {
-        const var_t v = queue.back();
-        queue.pop_back();
+    auto& visited = ws.mark[0];
+    visited.clear(no_v);
+    auto& st = ws.st[0];
+    st.clear();
+    st.push_back(src);
+    visited.mark(IL[src]);
+    while(!st.empty()) {
+        const vert_t v = st.back();
+        st.pop_back();
         for(const auto& n : get_out_neighbour_range(v)) {
             if(n==dst) return true;
-            queue.push_back(n);
+            if(visited.is_marked(IL[n])) continue;
+            visited.mark(IL[n]);
+            st.push_back(n);
         }
     }
     return false;
@@ -605,7 +1075,7 @@ std::pair< LinEqs, LinEqs > impl_graph::first_vert() const {
     //assert(no_v>0);
     //return std::move( std::pair< LinEqs, LinEqs >( LinEqs( std::move( vl.Vxlit(L[0]) ) ), LinEqs( std::move( vl.Vxlit(L[0]).add_one() ) ) ) );
     //guess single ind
-    var_t i = 0;
+    vert_t i = 0;
     var_t lt = 0;
     while(lt == 0) {
         assert(no_v>i);
@@ -620,12 +1090,11 @@ std::pair< LinEqs, LinEqs > impl_graph::first_vert() const {
 }
 
 vec<lineral> tree_xlits;
-vec<bool> marked;
-std::stack<var_t> queue;
 std::pair< LinEqs, LinEqs > impl_graph::max_reach() const {
     //find max tree by traversing TO in reverse
     //TODO can we adapt code from TO to do it in one go? (otherwise two full traversals of the graph are necessary...)
-    vec<int> tree_score(no_v, 1);
+    auto& tree_score = ws.iscr[0];
+    tree_score.assign(no_v, 1);
     //init tree_score
     if(opt.score == sc::active) {
         for (const auto &v : get_v_range()) {
@@ -633,30 +1102,32 @@ std::pair< LinEqs, LinEqs > impl_graph::max_reach() const {
         }
     }
     
-    var_t v_max_tree = L[0];
+    vert_t v_max_tree = L[0];
     //compute topological ordering of graph
     const auto TO = get_TO();
     //traverse through it in reverse, and calculate tree_size
     for (auto v_it = TO.rbegin(); v_it != TO.rend(); ++v_it) {
-        const var_t v = *v_it;
+        const vert_t v = *v_it;
         for (const auto &w : get_out_neighbour_range(v)) {
             tree_score[IL[v]] += tree_score[IL[w]];
         }
-        if(tree_score[IL[v]] > tree_score[IL[v_max_tree]]) v_max_tree = v;
+        //break ties by position in L, s.t. the choice does not depend on the (maintained) TO
+        if(tree_score[IL[v]] > tree_score[IL[v_max_tree]] || (tree_score[IL[v]] == tree_score[IL[v_max_tree]] && IL[v] > IL[v_max_tree])) v_max_tree = v;
     }
 
     //compute tree LinEqs (all out-neighbours):
+    auto& marked = ws.mark[0];
+    auto& queue = ws.st[0];
     tree_xlits.clear();
-    marked.clear();
-    marked.resize(no_v, false);
-    while(!queue.empty()) queue.pop();
-    queue.push(v_max_tree);
-    marked[IL[v_max_tree]] = true;
+    marked.clear(no_v);
+    queue.clear();
+    queue.push_back(v_max_tree);
+    marked.mark(IL[v_max_tree]);
     while(!queue.empty()) {
-        var_t v = queue.top();
-        queue.pop();
+        vert_t v = queue.back();
+        queue.pop_back();
         //fast exit if SIGMA(v) was already marked!
-        if(marked[IL[SIGMA(v)]]) {
+        if(marked.is_marked(IL[SIGMA(v)])) {
             tree_xlits.clear();
             tree_xlits.emplace_back( lineral( cnst::one ) );
             break;
@@ -666,9 +1137,9 @@ std::pair< LinEqs, LinEqs > impl_graph::max_reach() const {
         tree_xlits.back().reduce(assignments);
     #endif
         for(const auto &w : get_out_neighbour_range(v)) {
-            if(!marked[IL[w]]) {
-                marked[IL[w]] = true;
-                queue.push(w);
+            if(!marked.is_marked(IL[w])) {
+                marked.mark(IL[w]);
+                queue.push_back(w);
             }
         }
     }
@@ -677,16 +1148,15 @@ std::pair< LinEqs, LinEqs > impl_graph::max_reach() const {
     tree_xlits.clear();
 
     //compute inv-tree LinEqs (all in-neighbours):
-    while(!queue.empty()) queue.pop();
-    queue.push(v_max_tree);
-    marked.clear();
-    marked.resize(no_v, false);
-    marked[IL[v_max_tree]] = true;
+    queue.clear();
+    queue.push_back(v_max_tree);
+    marked.clear(no_v);
+    marked.mark(IL[v_max_tree]);
     while(!queue.empty()) {
-        var_t v = queue.top();
-        queue.pop();
+        vert_t v = queue.back();
+        queue.pop_back();
         //fast exit if SIGMA(v) was already marked!
-        if(marked[IL[SIGMA(v)]]) {
+        if(marked.is_marked(IL[SIGMA(v)])) {
             tree_xlits.clear();
             tree_xlits.emplace_back( lineral( cnst::one ) );
             break;
@@ -696,9 +1166,9 @@ std::pair< LinEqs, LinEqs > impl_graph::max_reach() const {
         tree_xlits.back().reduce(assignments);
     #endif
         for(const auto &w : get_in_neighbour_range(v)) {
-            if(!marked[IL[w]]) {
-                marked[IL[w]] = true;
-                queue.push(w);
+            if(!marked.is_marked(IL[w])) {
+                marked.mark(IL[w]);
+                queue.push_back(w);
             }
         }
     }
@@ -710,27 +1180,29 @@ std::pair< LinEqs, LinEqs > impl_graph::max_reach() const {
 std::pair< LinEqs, LinEqs > impl_graph::max_bottleneck() const {
     //find max tree by traversing TO in reverse
     //TODO can we adapt code from TO to do it in one go? (otherwise two full traversals of the graph are necessary...)
-    vec<int> bn_in_score(no_v, 1);
-    vec<int> bn_out_score(no_v, 1);
+    auto& bn_in_score = ws.iscr[0];
+    auto& bn_out_score = ws.iscr[1];
+    bn_in_score.assign(no_v, 1);
+    bn_out_score.assign(no_v, 1);
     //init tree_score
     for (const auto &v : get_v_range()) {
         bn_in_score[IL[v]] = activity_score[ vl.Vxlit_LT(v) ];
         bn_out_score[IL[v]] = activity_score[ vl.Vxlit_LT(v) ];
     }
     
-    var_t v_max_bn = L[0];
+    vert_t v_max_bn = L[0];
     //compute topological ordering of graph
     const auto TO = get_TO();
     //traverse through it twice, one time in order and once in reverse; in the latter find maximum
     for (auto v_it = TO.begin(); v_it != TO.end(); ++v_it) {
-        const var_t v = *v_it;
+        const vert_t v = *v_it;
         //TODO bn_score is actually an upper bound on the score; as 1 -> 2 -> 3 and 1 -> 3, makes 3 seem to have 3 incoming nodes, '1' is counted twice!
         for (const auto &w : get_in_neighbour_range(v)) {
             bn_in_score[IL[v]] += bn_in_score[IL[w]];
         }
     }
     for (auto v_it = TO.rbegin(); v_it != TO.rend(); ++v_it) {
-        const var_t v = *v_it;
+        const vert_t v = *v_it;
         //TODO bn_score is actually an upper bound on the score; as 1 -> 2 -> 3 and 1 -> 3, makes 3 seem to have 3 incoming nodes, '1' is counted twice!
         for (const auto &w : get_in_neighbour_range(v)) {
             bn_out_score[IL[v]] += bn_out_score[IL[w]];
@@ -741,49 +1213,57 @@ std::pair< LinEqs, LinEqs > impl_graph::max_bottleneck() const {
     }
     
     //compute tree LinEqs (all out-neighbours):
+    auto& marked = ws.mark[0];
+    auto& queue = ws.st[0];
     tree_xlits.clear();
-    while(!queue.empty()) queue.pop();
-    queue.push(v_max_bn);
-    marked.clear();
-    marked.resize(no_v);
+    queue.clear();
+    queue.push_back(v_max_bn);
+    marked.clear(no_v);
+    marked.mark(IL[v_max_bn]);
     while(!queue.empty()) {
-        var_t v = queue.top();
-        if(marked[IL[SIGMA(v)]]) {
+        vert_t v = queue.back();
+        if(marked.is_marked(IL[SIGMA(v)])) {
             tree_xlits.clear();
             tree_xlits.emplace_back( lineral( cnst::one ) );
             break;
         };
-        queue.pop();
+        queue.pop_back();
         tree_xlits.emplace_back( std::move( vl.Vxlit(v) ) );
     #ifndef FULL_REDUCTION
         tree_xlits.back().reduce(assignments);
     #endif
         for(const auto &w : get_out_neighbour_range(v)) {
-            if(!marked[IL[w]]) queue.push(w);
+            if(!marked.is_marked(IL[w])) {
+                marked.mark(IL[w]);
+                queue.push_back(w);
+            }
         }
     }
     const LinEqs tree_xsys = LinEqs( std::move(tree_xlits) );
     tree_xlits.clear();
 
     //compute inv-tree LinEqs (all in-neighbours):
-    while(!queue.empty()) queue.pop();
-    queue.push(v_max_bn);
-    marked.clear();
-    marked.resize(no_v);
+    queue.clear();
+    queue.push_back(v_max_bn);
+    marked.clear(no_v);
+    marked.mark(IL[v_max_bn]);
     while(!queue.empty()) {
-        var_t v = queue.top();
-        if(marked[IL[SIGMA(v)]]) {
+        vert_t v = queue.back();
+        if(marked.is_marked(IL[SIGMA(v)])) {
             tree_xlits.clear();
             tree_xlits.emplace_back( lineral( cnst::one ) );
             break;
         };
-        queue.pop();
+        queue.pop_back();
         tree_xlits.emplace_back( std::move( vl.Vxlit(v).add_one() ) );
     #ifndef FULL_REDUCTION
         tree_xlits.back().reduce(assignments);
     #endif
         for(const auto &w : get_in_neighbour_range(v)) {
-            if(!marked[IL[w]]) queue.push(w);
+            if(!marked.is_marked(IL[w])) {
+                marked.mark(IL[w]);
+                queue.push_back(w);
+            }
         }
     }
     const LinEqs inv_tree_xsys = LinEqs( std::move(tree_xlits) );
@@ -818,14 +1298,16 @@ std::pair< LinEqs, LinEqs > impl_graph::max_path() const {
     //find max path by traversing TO in reverse
     if(no_e == 0) return first_vert(); //contains no edges, i.e., longest path is of length 1, i.e., we guess a single vertex!
     //TODO can we adapt code from TO to do it in one go? (otherwise two full traversals of the graph are necessary...)
-    vec<var_t> path_length(no_v, 1);
-    vec<var_t> path_next(no_v);
-    var_t v_max_path_src = L[0];
+    auto& path_length = ws.scr[1];
+    auto& path_next = ws.scr[2];
+    path_length.assign(no_v, 1);
+    path_next.resize(no_v);
+    vert_t v_max_path_src = L[0];
     //compute topological ordering of graph
     const auto TO = get_TO();
     //traverse through it in reverse, and calculate tree_size
     for (auto v_it = TO.rbegin(); v_it != TO.rend(); ++v_it) {
-        const var_t v = *v_it;
+        const vert_t v = *v_it;
         if(get_out_degree(v) == 0) path_next[IL[v]] = v;
         assert( path_length[IL[v]] == 1 );
         for (const auto &w : get_out_neighbour_range(v)) {
@@ -835,7 +1317,8 @@ std::pair< LinEqs, LinEqs > impl_graph::max_path() const {
                 path_next[IL[v]] = w;
             }
         }
-        if(path_length[IL[v]] > path_length[IL[v_max_path_src]]) v_max_path_src = v;
+        //break ties by position in L, s.t. the choice does not depend on the (maintained) TO
+        if(path_length[IL[v]] > path_length[IL[v_max_path_src]] || (path_length[IL[v]] == path_length[IL[v_max_path_src]] && IL[v] > IL[v_max_path_src])) v_max_path_src = v;
     }
 
     assert(path_length[IL[v_max_path_src]] > 1);
@@ -843,8 +1326,8 @@ std::pair< LinEqs, LinEqs > impl_graph::max_path() const {
     //construct cycle and no_cycle LinEqs:
     auto cycle_xlits = vec<lineral>();
     cycle_xlits.reserve(path_length[IL[v_max_path_src]]);
-    var_t v = v_max_path_src;
-    for (var_t i = 0; i < path_length[IL[v_max_path_src]]; i++) {
+    vert_t v = v_max_path_src;
+    for (vert_t i = 0; i < path_length[IL[v_max_path_src]]; i++) {
         //cycle_xlits.emplace_back( std::move( vl.Vxlit(v)+vl.Vxlit(path_next[IL[v]]) ) );
         cycle_xlits.emplace_back( std::move( Vxlit_sum(v,path_next[IL[v]]) ) );
     #ifndef FULL_REDUCTION
@@ -876,21 +1359,24 @@ std::pair< LinEqs, LinEqs > impl_graph::max_score_path() const {
     //find max path by traversing TO in reverse
     if(no_e == 0) return first_vert(); //contains no edges, i.e., longest path is of length 1, i.e., we guess a single vertex!
     //TODO can we adapt code from TO to do it in one go? (otherwise two full traversals of the graph are necessary...)
-    vec<var_t> path_score(no_v, 1);
-    vec<var_t> path_length(no_v, 1);
-    vec<var_t> path_next(no_v);
-    var_t v_max_path_src = L[0];
+    auto& path_score = ws.scr[1];
+    auto& path_length = ws.scr[2];
+    auto& path_next = ws.scr[3];
+    path_score.assign(no_v, 1);
+    path_length.assign(no_v, 1);
+    path_next.resize(no_v);
+    vert_t v_max_path_src = L[0];
     //compute topological ordering of graph
     const auto TO = get_TO();
     //traverse through it in reverse, and calculate tree_size
     for (auto v_it = TO.rbegin(); v_it != TO.rend(); ++v_it) {
-        const var_t v = *v_it;
+        const vert_t v = *v_it;
         const int vert_score = activity_score[ vl.Vxlit_LT(v) ];
         path_score[IL[v]] = vert_score;
         if(get_out_degree(v) == 0) { 
             path_next[IL[v]] = v;
         } else {
-            int best_out_score = 0;
+            vert_t best_out_score = 0;
             //find best outgoing path
             for (const auto &w : get_out_neighbour_range(v)) {
                 if(path_score[IL[w]] > best_out_score) {
@@ -902,7 +1388,8 @@ std::pair< LinEqs, LinEqs > impl_graph::max_score_path() const {
             path_score[IL[v]] += best_out_score;
             //path_score[IL[v]] *= best_out_score;
         }
-        if(path_score[IL[v]] > path_score[IL[v_max_path_src]]) v_max_path_src = v;
+        //break ties by position in L, s.t. the choice does not depend on the (maintained) TO
+        if(path_score[IL[v]] > path_score[IL[v_max_path_src]] || (path_score[IL[v]] == path_score[IL[v_max_path_src]] && IL[v] > IL[v_max_path_src])) v_max_path_src = v;
     }
 
     VERB(40, "c chosen path has score " << path_score[IL[v_max_path_src]] << " and length " << path_length[IL[v_max_path_src]])
@@ -911,8 +1398,8 @@ std::pair< LinEqs, LinEqs > impl_graph::max_score_path() const {
         //construct cycle and no_cycle LinEqs:
         auto cycle_xlits = vec<lineral>();
         cycle_xlits.reserve(path_length[IL[v_max_path_src]]);
-        var_t v = v_max_path_src;
-        for (var_t i = 0; i < path_length[IL[v_max_path_src]]; i++) {
+        vert_t v = v_max_path_src;
+        for (vert_t i = 0; i < path_length[IL[v_max_path_src]]; i++) {
             //cycle_xlits.emplace_back( std::move( vl.Vxlit(v)+vl.Vxlit(path_next[IL[v]]) ) );
             cycle_xlits.emplace_back( std::move( Vxlit_sum(v,path_next[IL[v]]) ) );
         #ifndef FULL_REDUCTION
@@ -956,7 +1443,8 @@ LinEqs impl_graph::fls_trivial_cc() const {
     //((2)) find FLS starting only from roots r where r and sigma[r] are in the same component
     //(1) compute roots
     //auto roots = get_roots();
-    std::list<var_t> roots;
+    auto& roots = ws.st[1];
+    roots.clear();
     // initialize the queue with all the vertices with no inbound edges
     for (const auto &v : get_v_range()) {
         if( (get_in_degree(v) == 0) && (label[IL[v]] == label[IL[SIGMA(v)]]) ) roots.push_back(v);
@@ -964,67 +1452,32 @@ LinEqs impl_graph::fls_trivial_cc() const {
 
     //(2) from every root r perform dfs; on discovery of v mark it with r and check if SIGMA(v) was already marked with r;
     //    in that case the root r is a failed lineral (or one of its descendents!)
-    std::list<var_t> failing_v;
-    vec<bool> marked(no_v, false);
-    vec<var_t> root(no_v, L.size());
-    std::stack<var_t> dfs_q;
+    vec<vert_t> failing_v;
+    auto& marked = ws.mark[0];
+    marked.clear(no_v);
+    auto& root = ws.scr[0];
+    root.resize(no_v);
+    auto& dfs_q = ws.st[0];
+    dfs_q.clear();
     for(const auto& r : roots) {
-        dfs_q.push(r);
+        dfs_q.push_back(r);
         while(!dfs_q.empty()) {
-            const auto v = dfs_q.top();
-            dfs_q.pop();
-            if(marked[IL[v]]) continue;
+            const auto v = dfs_q.back();
+            dfs_q.pop_back();
+            if(marked.is_marked(IL[v])) continue;
             //discover v
-            if(marked[IL[SIGMA(v)]] && root[IL[SIGMA(v)]] == r) {
+            if(marked.is_marked(IL[SIGMA(v)]) && root[IL[SIGMA(v)]] == r) {
                 failing_v.emplace_back( v );
             }
-            marked[IL[v]] = true;
+            marked.mark(IL[v]);
             root[IL[v]] = r;
             for(const auto& n : get_out_neighbour_range(v)) {
-                if(!marked[IL[n]]) dfs_q.push(n);
-            }
-        }
-    }
-    // (3) for each pair (n,v) in flits we get at least one failed lineral; 
-    vec<bool> marked_sigma(no_v,false);
-
-    //for each r in failing_v run a ascending bfs from r and SIGMA(r); all elements in the intersection are failed linerals!
-    vec<lineral> f_xlits;
-    for(const auto& r : failing_v) {
-        for(var_t i=0; i<marked.size(); ++i) {
-            marked[i] = false;
-            marked_sigma[i] = false;
-        }
-        //dfs from r
-        dfs_q.push(r);
-        while(!dfs_q.empty()) {
-            const auto v = dfs_q.top();
-            dfs_q.pop();
-            if(marked[IL[v]]) continue;
-            //discover v
-            marked[IL[v]] = true;
-            for(const auto& n : get_in_neighbour_range(v)) if(!marked[IL[n]]) dfs_q.push(n);
-        }
-        //dfs from SIGMA(r)
-        dfs_q.push(SIGMA(r));
-        while(!dfs_q.empty()) {
-            const auto v = dfs_q.top();
-            dfs_q.pop();
-            if(marked_sigma[IL[v]]) continue;
-            //discover v
-            marked_sigma[IL[v]] = true;
-            if(marked[IL[v]]) {
-                //FAILED LINERAL FOUND!
-                f_xlits.emplace_back( std::move( vl.Vxlit(v) ) );
-                f_xlits.back().add_one();
-            #ifndef FULL_REDUCTION
-                f_xlits.back().reduce(assignments);
-            #endif
+                if(!marked.is_marked(IL[n])) dfs_q.push_back(n);
             }
-            for(const auto& n : get_in_neighbour_range(v)) if(!marked_sigma[IL[n]]) dfs_q.push(n);
         }
     }
-    return LinEqs( std::move(f_xlits) );
+    // (3) for each pair (n,v) in flits we get at least one failed lineral
+    return fls_trivial(failing_v);
 }
 
 LinEqs impl_graph::fls_trivial() const {
@@ -1032,76 +1485,40 @@ LinEqs impl_graph::fls_trivial() const {
     auto roots = get_roots();
     //(2) from every root r perform dfs; on discovery of v mark it with r and check if SIGMA(v) was already marked with r;
     //    in that case the root r is a failed lineral (or one of its descendents!)
-    std::list<var_t> failing_v;
-    vec<var_t> mark_root(no_v);
-    vec<bool>marked(no_v, false);
-    std::stack<var_t> dfs_q;
+    vec<vert_t> failing_v;
+    auto& mark_root = ws.scr[0];
+    mark_root.resize(no_v);
+    auto& marked = ws.mark[0];
+    marked.clear(no_v);
+    auto& dfs_q = ws.st[0];
+    dfs_q.clear();
     for(const auto& r : roots) {
-        dfs_q.push(r);
+        dfs_q.push_back(r);
         while(!dfs_q.empty()) {
-            const auto v = dfs_q.top();
-            dfs_q.pop();
-            if(marked[IL[v]]) continue;
+            const auto v = dfs_q.back();
+            dfs_q.pop_back();
+            if(marked.is_marked(IL[v])) continue;
             //discover v
-            if(marked[IL[SIGMA(v)]] && mark_root[IL[SIGMA(v)]] == r) {
+            if(marked.is_marked(IL[SIGMA(v)]) && mark_root[IL[SIGMA(v)]] == r) {
                 failing_v.emplace_back( v );
             }
-            marked[IL[v]] = true;
+            marked.mark(IL[v]);
             mark_root[IL[v]] = r;
             for(const auto& n : get_out_neighbour_range(v)) {
-                if(!marked[IL[n]]) dfs_q.push(n);
-            }
-        }
-    }
-    // (3) for each pair (n,v) in flits we get at least one failed lineral; 
-    vec<bool> marked_sigma(no_v,false);
-
-    //for each r in failing_v run a ascending bfs from r and SIGMA(r); all elements in the intersection are failed linerals!
-    vec<lineral> f_xlits;
-    for(const auto& r : failing_v) {
-        for(var_t i=0; i<marked.size(); ++i) {
-            marked[i] = false;
-            marked_sigma[i] = false;
-        }
-        //dfs from r
-        dfs_q.push(r);
-        while(!dfs_q.empty()) {
-            const auto v = dfs_q.top();
-            dfs_q.pop();
-            if(marked[IL[v]]) continue;
-            //discover v
-            marked[IL[v]] = true;
-            for(const auto& n : get_in_neighbour_range(v)) if(!marked[IL[n]]) dfs_q.push(n);
-        }
-        //dfs from SIGMA(r)
-        dfs_q.push(SIGMA(r));
-        while(!dfs_q.empty()) {
-            const auto v = dfs_q.top();
-            dfs_q.pop();
-            if(marked_sigma[IL[v]]) continue;
-            //discover v
-            marked_sigma[IL[v]] = true;
-            if(marked[IL[v]]) {
-                //FAILED lineral FOUND!
-                f_xlits.emplace_back( std::move( vl.Vxlit(v) ) );
-                f_xlits.back().add_one();
-            #ifndef FULL_REDUCTION
-                f_xlits.back().reduce(assignments);
-            #endif
+                if(!marked.is_marked(IL[n])) dfs_q.push_back(n);
             }
-            for(const auto& n : get_in_neighbour_range(v)) if(!marked_sigma[IL[n]]) dfs_q.push(n);
         }
     }
-    return LinEqs( std::move(f_xlits) );
+    return fls_trivial(failing_v);
     /*
     vec<lineral> new_xlits;
-    vec< robin_hood::unordered_flat_set<var_t> > reaches(no_v);
-    //vec< std::set<var_t> > reaches(no_v);
+    vec< robin_hood::unordered_flat_set<vert_t> > reaches(no_v);
+    //vec< std::set<vert_t> > reaches(no_v);
     vec<bool> failed(no_v, false);
 
     const auto TO = get_TO();
     for (auto v_it = TO.rbegin(); v_it != TO.rend(); ++v_it) {
-        const var_t v = *v_it;
+        const vert_t v = *v_it;
         if(failed[IL[v]]) continue;
         reaches[ IL[v] ].insert( v );
         for (const auto &w : get_out_neighbour_range(v)) {
@@ -1131,6 +1548,50 @@ LinEqs impl_graph::fls_trivial() const {
     */
 };
 
+LinEqs impl_graph::fls_trivial(const vec<vert_t>& failing_v) const {
+    // (3) for each pair (n,v) in flits we get at least one failed lineral; 
+    auto& marked = ws.mark[0];
+    auto& marked_sigma = ws.mark[1];
+    auto& dfs_q = ws.st[0];
+    dfs_q.clear();
+
+    //for each r in failing_v run a ascending bfs from r and SIGMA(r); all elements in the intersection are failed linerals!
+    vec<lineral> f_xlits;
+    for(const auto& r : failing_v) {
+        marked.clear(no_v);
+        marked_sigma.clear(no_v);
+        //dfs from r
+        dfs_q.push_back(r);
+        while(!dfs_q.empty()) {
+            const auto v = dfs_q.back();
+            dfs_q.pop_back();
+            if(marked.is_marked(IL[v])) continue;
+            //discover v
+            marked.mark(IL[v]);
+            for(const auto& n : get_in_neighbour_range(v)) if(!marked.is_marked(IL[n])) dfs_q.push_back(n);
+        }
+        //dfs from SIGMA(r)
+        dfs_q.push_back(SIGMA(r));
+        while(!dfs_q.empty()) {
+            const auto v = dfs_q.back();
+            dfs_q.pop_back();
+            if(marked_sigma.is_marked(IL[v])) continue;
+            //discover v
+            marked_sigma.mark(IL[v]);
+            if(marked.is_marked(IL[v])) {
+                //FAILED lineral FOUND!
+                f_xlits.emplace_back( std::move( vl.Vxlit(v) ) );
+                f_xlits.back().add_one();
+            #ifndef FULL_REDUCTION
+                f_xlits.back().reduce(assignments);
+            #endif
+            }
+            for(const auto& n : get_in_neighbour_range(v)) if(!marked_sigma.is_marked(IL[n])) dfs_q.push_back(n);
+        }
+    }
+    return LinEqs( std::move(f_xlits) );
+};
+
 LinEqs impl_graph::fls_full() const {
     vec<lineral> new_xlits;
     //compute topological ordering of graph
@@ -1138,7 +1599,7 @@ LinEqs impl_graph::fls_full() const {
     
     vec<LinEqs> D(no_v);
     for (auto v_it = TO.rbegin(); v_it != TO.rend(); ++v_it) {
-        var_t v = *v_it;
+        vert_t v = *v_it;
         lineral f = vl.Vxlit(v);
         D[IL[v]] += LinEqs(f);
         for (const auto &w : get_in_neighbour_range(v)) D[IL[w]] += D[IL[v]];
@@ -1146,10 +1607,11 @@ LinEqs impl_graph::fls_full() const {
     }
 
     //now deduce <D[f]> cap <D[f+1]> for all f
-    vec<bool> marked(no_v, false);
+    auto& marked = ws.mark[0];
+    marked.clear(no_v);
     for(const auto &v : get_v_range()) {
-        if(marked[IL[SIGMA(v)]]) continue;
-        marked[IL[v]] = true;
+        if(marked.is_marked(IL[SIGMA(v)])) continue;
+        marked.mark(IL[v]);
         const auto intVS = intersect(D[IL[v]], D[IL[SIGMA(v)]]);
         if(intVS.size()<1) continue;
         VERB(80, "c GFLS derived "+std::to_string(intVS.size())+" new eqs");
@@ -1170,16 +1632,17 @@ LinEqs impl_graph::fls_full_implied() {
     
     vec<LinEqs> D(no_v);
     for (auto v_it = TO.rbegin(); v_it != TO.rend(); ++v_it) {
-        var_t v = *v_it;
+        vert_t v = *v_it;
         lineral f = vl.Vxlit(v);
         D[IL[v]] = implied_xlits(f);
     }
 
     //now deduce <D[f]> cap <D[f+1]> for all f
-    vec<bool> marked(no_v, false);
+    auto& marked = ws.mark[0];
+    marked.clear(no_v);
     for(const auto &v : get_v_range()) {
-        if(marked[IL[SIGMA(v)]]) continue;
-        marked[IL[v]] = true;
+        if(marked.is_marked(IL[SIGMA(v)])) continue;
+        marked.mark(IL[v]);
         const auto intVS = intersect(D[IL[v]], D[IL[SIGMA(v)]]);
         if(intVS.size()<1) continue;
         VERB(80, "c GFLS derived "+std::to_string(intVS.size())+" new eqs");
@@ -1200,7 +1663,7 @@ LinEqs impl_graph::fls_full_implied() {
 //    const auto TO = get_TO();
 //    
 //    for (auto v_it = TO.rbegin(); v_it != TO.rend(); ++v_it) {
-//        var_t v = *v_it;
+//        vert_t v = *v_it;
 //        if(get_out_degree(v) == 0) {
 //            prev_xsys[ IL[v] ] = LinEqs( std::move( vl.Vxlit(v) ) );
 //        } else {
@@ -1289,8 +1752,13 @@ void impl_graph::crGCP(stats& s, const upd_t upd_graph, const fls_t fls_alg, con
         } while (upd.size() > 0 && upd.is_consistent());
         if(!upd.is_consistent()) return;
         
-        //in-processing!
-        scc = scc_analysis();
+        //in-processing! -- if the maintained TO is valid, the graph is a DAG, i.e., there are no SCCs to merge
+        if(to.is_valid()) {
+            scc = LinEqs();
+            fls_trivial_v_valid = false;
+        } else {
+            scc = scc_analysis();
+        }
         if(scc.size() > 0) {
             s.new_px_scc += scc.size();
             add_new_xsys( scc );
@@ -1301,7 +1769,9 @@ void impl_graph::crGCP(stats& s, const upd_t upd_graph, const fls_t fls_alg, con
         if(!scc.is_consistent()) return;
         
         if(scc.size() == 0 && (!scheduled_fls || (s.no_crGCP % opt.fls_s == 0))) {
-            fls = (this->*fls_alg)();
+            //trivial fls were already found by scc_analysis if it did not modify the graph
+            if(fls_alg == static_cast<fls_t>(&impl_graph::fls_trivial) && fls_trivial_v_valid) fls = fls_trivial(fls_trivial_v);
+            else fls = (this->*fls_alg)();
             if(fls.size() > 0) {
                 s.new_px_fls += fls.size();
                 add_new_xsys( fls );
@@ -1384,6 +1854,16 @@ stats impl_graph::dpll_solve(stats& s) {
     VERB(45, graph_stats());
     crGCP(s, upd, fls);
     VERB(45, graph_stats());
+    //remove transitively redundant edges -- does not change the linerals implied by crGCP, but speeds up all later traversals
+    if(linsys.is_consistent()) {
+        const edge_cnt_t no_e_before = no_e;
+        const edge_cnt_t no_e_tr = transitive_reduction();
+        VERB(25, "c transitive reduction removed " << std::to_string(no_e_tr) << " of " << std::to_string(no_e_before) << " edges")
+        //renumber remaining verts densely
+        const vert_t no_v_freed = compact();
+        VERB(25, "c compaction freed " << std::to_string(no_v_freed) << " vertex ids, " << std::to_string(no_v) << " verts remain")
+        gc_level0();
+    }
 
     while( no_e > 0 || !linsys.is_consistent() ) {
         if( s.cancelled.load() ) {
@@ -1425,6 +1905,8 @@ stats impl_graph::dpll_solve(stats& s) {
             backtrack( std::move(graph_stack.top()) );
             assert( assert_data_structs() );
             graph_stack.pop();
+            to.backtrack( std::move(to_stack.top()) );
+            to_stack.pop();
             //add forced alt decision
             add_new_xsys( std::move(backtrack_xsys.top()) );
             //Lsys.emplace_back( backtrack_xsys.top() );
@@ -1457,6 +1939,7 @@ stats impl_graph::dpll_solve(stats& s) {
             ++s.no_dec;
             //save state
             graph_stack.push( std::move(get_state()) );
+            to_stack.push( to.get_state() );
              //duplicate top of vl_stack
             vl_stack.push( std::move(vl.get_state()) );
 
@@ -1469,10 +1952,16 @@ stats impl_graph::dpll_solve(stats& s) {
         
         //update graph
         crGCP(s, upd, fls);
+        //at level 0 the level-0 systems and labels only grow; collect their garbage
+        if(dl == 0 && linsys.is_consistent()) {
+            const std::size_t freed = gc_level0();
+            VERB(25, "c level-0 gc freed " << std::to_string(freed) << " label nodes")
+        }
 
         VERB(45, graph_stats());
         assert((var_t) graph_stack.size() == dl+1);
         assert((var_t) vl_stack.size()  == dl+1);
+        assert((var_t) to_stack.size()  == dl+1);
         assert((var_t) xsys_stack.size()  == dl+1);
     }
 
@@ -1526,7 +2015,7 @@ vec< vec<lineral> > impl_graph::to_xcls() const {
 
 std::string impl_graph::to_xnf_string() const {
     auto xclss_str = std::set<std::string>();
-    var_t n_cls = 0;
+    edge_cnt_t n_cls = 0;
     //go through edges
     for(const auto& v : get_v_range()) {
         const lineral fp1 = vl.Vxlit(v).add_one();
@@ -1561,10 +2050,10 @@ std::string impl_graph::to_xnf_string() const {
 
 //overwrite to_str() func
 std::string impl_graph::to_str() const noexcept {
-    std::map<var_t, vec<var_t> > edges;
-    for (var_t c_idx = 0; c_idx < no_v; ++c_idx) {
+    std::map<vert_t, vec<vert_t> > edges;
+    for (vert_t c_idx = 0; c_idx < no_v; ++c_idx) {
         //get color at c_idx
-        const var_t c = L[c_idx];
+        const vert_t c = L[c_idx];
         //add all out-neighbors to edges[c_idx]
         edges[c] = get_out_neighbour_vector( c );
     #ifdef USE_LHGR
@@ -1579,7 +2068,7 @@ std::string impl_graph::to_str() const noexcept {
     for (const auto &[src,v] : edges) {
         vec<std::string> out_edges_str( v.size() );
         //construct strings!
-        auto to_str = [&](const var_t dst) -> std::string {return "(" + vl.Vxlit(src).to_str() + "," + vl.Vxlit(dst).to_str() + ")";};
+        auto to_str = [&](const vert_t dst) -> std::string {return "(" + vl.Vxlit(src).to_str() + "," + vl.Vxlit(dst).to_str() + ")";};
         std::transform(v.begin(), v.end(), out_edges_str.begin(), to_str);
         std::sort(out_edges_str.begin(), out_edges_str.end());
 
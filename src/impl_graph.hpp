@@ -29,12 +29,21 @@
 #include "solve.hpp"
 #include "misc.hpp"
 #include "graph/graph.hpp"
+#include "graph/reach_index.hpp"
+#include "graph/topo_order.hpp"
+#include "graph/traversal_ws.hpp"
 #include "LA/lineral.hpp"
 #include "LA/lineqs.hpp"
 
 #define Lsys xsys_stack.back()
 #define linsys xsys_stack.back().back()
 
+//minimal number of active vertices for which scc_analysis uses the parallel forward-backward algorithm
+#define SCC_PAR_THRESHOLD 4096
+//maximal size of a connected component that is transitively reduced exactly; in larger ones each search is limited to TR_BUDGET visited verts
+#define TR_EXACT_THRESHOLD 2048
+#define TR_BUDGET 256
+
 #include "vl/vl.hpp"
 
 /**
@@ -55,6 +64,21 @@ class impl_graph : public graph
      */
     std::stack< graph_repr > graph_stack;
 
+    /**
+     * @brief topological order of the graph; maintained under merges and removals of verts
+     */
+    topo_order to;
+
+    /**
+     * @brief stack of topo_order_repr for backtracking
+     */
+    std::stack< topo_order_repr > to_stack;
+
+    /**
+     * @brief workspace for graph traversals, i.e., marks, stacks and scratch arrays that are reused by all traversals
+     */
+    mutable traversal_ws ws;
+
     /**
      * @brief stack of lists of xsyses for backtracking
      */
@@ -85,9 +109,34 @@ class impl_graph : public graph
     unsigned int bump = 1;
     float decay = 0.9;
 
-    //SCC-helper funcs
-    void scc_dfs_util(const var_t rt, vec<lineral>& linerals, var_t v, vec<bool>& visited, std::list< std::pair<var_t,var_t> >& merge_list) const;
-    void scc_fillOrder(const var_t v, vec<bool>& visited, std::stack<var_t> &Stack) const;
+    /**
+     * @brief verts v s.t. v and SIGMA(v) are reachable from the same root; computed by the last call to scc_analysis
+     */
+    vec<vert_t> fls_trivial_v;
+
+    /**
+     * @brief true iff fls_trivial_v belongs to the current graph, i.e., the last scc_analysis used scc_tarjan and did not merge any verts
+     */
+    bool fls_trivial_v_valid = false;
+
+    /**
+     * @brief computes the SCCs with an iterative version of Tarjan's algorithm; DFS trees are started from the roots first.
+     *        Additionally, all verts v are collected s.t. v and SIGMA(v) are reachable from the same root (see fls_trivial).
+     * 
+     * @param merge_list list of pairs (rt,v) s.t. v is in the SCC with root rt; contains only one SCC of each symmetric pair
+     * @param failing_v verts v s.t. SIGMA(v) was discovered before by the DFS from the same root
+     */
+    void scc_tarjan(vec< std::pair<vert_t,vert_t> >& merge_list, vec<vert_t>& failing_v) const;
+
+    /**
+     * @brief computes the SCCs with the forward-backward algorithm; vertices that cannot lie on a cycle are trimmed first,
+     *        the remaining partitions are then split in parallel rounds (OpenMP). If the SCC of the pivot p is found and SIGMA(p)
+     *        is in the same partition, the symmetric SCC is obtained without further search.
+     * 
+     * @param merge_list list of pairs (rt,v) s.t. v is in the SCC with root rt; contains only one SCC of each symmetric pair
+     * @note result does not depend on the number of threads
+     */
+    void scc_fwbw(vec< std::pair<vert_t,vert_t> >& merge_list) const;
 
     typedef LinEqs (impl_graph::*upd_t)(stats& s, const LinEqs&);
     typedef LinEqs (impl_graph::*fls_t)() const;
@@ -109,6 +158,7 @@ class impl_graph : public graph
     LinEqs implied_xlits(lineral& lit) {
       //(1) save state
       auto g_state = get_state();
+      auto to_state = to.get_state();
       auto vl_state = vl.get_state();
       xsys_stack.emplace_back( std::list<LinEqs>() );
       add_new_xsys( lit );
@@ -125,13 +175,14 @@ class impl_graph : public graph
       //revert assignments
       xsys_stack.pop_back();
       backtrack( std::move(g_state) );
+      to.backtrack( std::move(to_state) );
       assert( assert_data_structs() );
 
       return implied_lits;
     };
 
     //memory-friendly sum of two linerals
-    inline lineral Vxlit_sum(const var_t v1, const var_t v2) const {
+    inline lineral Vxlit_sum(const vert_t v1, const vert_t v2) const {
       bool v1_contained = vl.contains(v1);
       bool v2_contained = vl.contains(v2);
 
@@ -171,7 +222,7 @@ class impl_graph : public graph
     impl_graph(parsed_xnf& p_xnf) : impl_graph(p_xnf.cls, options(p_xnf.num_vars, p_xnf.num_cls)) {};
 
     //copy ctor
-    impl_graph(const impl_graph& ig) : graph(ig), vl(ig.vl), vl_stack(ig.vl_stack), graph_stack(ig.graph_stack), xsys_stack(ig.xsys_stack), opt(ig.opt), activity_score(ig.activity_score) {};
+    impl_graph(const impl_graph& ig) : graph(ig), vl(ig.vl), vl_stack(ig.vl_stack), graph_stack(ig.graph_stack), to(ig.to), to_stack(ig.to_stack), xsys_stack(ig.xsys_stack), opt(ig.opt), activity_score(ig.activity_score) {};
 
     ~impl_graph() = default;
 
@@ -194,6 +245,16 @@ class impl_graph : public graph
     LinEqs update_graph_hash_fight(stats& s, const LinEqs& L);
 
     LinEqs update_graph_hash_fight_dev(stats& s, const LinEqs& L);
+
+  #if defined(USE_TRIE) || defined(USE_HCONS)
+    /**
+     * @brief collects all active labelled verts whose label contains a pivot of L, i.e., the only verts whose labels change when they are reduced by L; uses the occurrence index of vl
+     * 
+     * @param L linear system
+     * @return const vec<vert_t>& collected verts in the order of get_v_range(); all active verts if collecting them is not cheaper
+     */
+    const vec<vert_t>& get_upd_verts(const LinEqs& L);
+  #endif
     
     //wrappers for update_funcs when stats are irrelevant
     inline LinEqs update_graph(const LinEqs& L) { return update_graph(s, L); };
@@ -202,37 +263,69 @@ class impl_graph : public graph
     inline LinEqs update_graph_hash_fight_dev(const LinEqs& L) { return update_graph_hash_fight_dev(s, L); };
 
     //in-processing
-    LinEqs scc_analysis();
+    /**
+     * @brief merges the SCCs of the graph, if the linerals they imply are consistent
+     * 
+     * @param par_thresh minimal number of active vertices for which the parallel forward-backward algorithm is used; otherwise Tarjan's algorithm is used
+     * @return LinEqs linerals implied by the SCCs
+     */
+    LinEqs scc_analysis(const vert_t par_thresh = SCC_PAR_THRESHOLD);
+
+    /**
+     * @brief removes transitively redundant edges, i.e., edges v->w s.t. there is another path from v to w; the symmetric edges are removed as well
+     * 
+     * @param exact_thresh maximal size of a connected component that is reduced exactly; larger ones are reduced approximately
+     * @param budget maximal number of verts visited per source vert in components larger than exact_thresh
+     * @return edge_cnt_t number of removed edges
+     * @note does nothing if the graph is not a DAG; the transitive closure of the graph is unchanged, i.e., so are the linerals implied by crGCP
+     */
+    edge_cnt_t transitive_reduction(const vert_t exact_thresh = TR_EXACT_THRESHOLD, const vert_t budget = TR_BUDGET);
+
+    /**
+     * @brief renumbers the active verts in Cuthill-McKee (bfs) order (SIGMA-pairs stay adjacent), and rebuilds the graph, the vertex labels and the topological order densely on the active verts only
+     * 
+     * @return vert_t number of freed vertex ids
+     * @note must only be called at decision level 0; discards all stored states, i.e., the current state becomes the new level-0 state
+     */
+    vert_t compact();
+
+    /**
+     * @brief garbage collection at decision level 0: merges all level-0 LinEqs into one reduced LinEqs, and rebuilds the vertex labels from the stored labels only if many were erased since the last collection
+     * 
+     * @return std::size_t number of freed nodes (trie) resp. slots (hash maps) of the vertex labels
+     * @note must only be called at decision level 0 while the linsys is consistent
+     */
+    std::size_t gc_level0();
 
     /**
      * @brief compute roots of graph
      * 
-     * @return std::list<var_t> contains all verts with indegree 0
+     * @return std::list<vert_t> contains all verts with indegree 0
      */
-    std::list<var_t> get_roots() const;
+    std::list<vert_t> get_roots() const;
 
     
     /**
      * @brief finds all connected components, and assigns all verts in one comp the same label; in each comp there is one vert with label[IL[v]]=v
      * 
-     * @return vec<var_t> labels; vert v has label label[IL[v]]
+     * @return vec<vert_t> labels; vert v has label label[IL[v]]
      * @note assumes graph is DAG
      */
-    vec<var_t> label_components() const;
+    vec<vert_t> label_components() const;
 
     /**
      * @brief returns the number of connected components
      * 
-     * @return var_t number of connected components
+     * @return vert_t number of connected components
      */
-    var_t get_number_connected_components() const;
+    vert_t get_number_connected_components() const;
 
     /**
      * @brief compute topological ordering of vertices
      * 
-     * @return vec<var_t> TO of vertices; empty iff graph has a cycle (or no_v==0)
+     * @return vec<vert_t> TO of vertices; empty iff graph has a cycle (or no_v==0)
      */
-    vec<var_t> get_TO() const;
+    vec<vert_t> get_TO() const;
     
     /**
      * @brief checks if graph is DAG
@@ -247,8 +340,9 @@ class impl_graph : public graph
      * @param v src
      * @param w dst
      * @return true iff there is a path v->w
+     * @note for repeated queries on the same DAG use a reach_index instead
      */
-    bool is_descendant(const var_t v, const var_t w);
+    bool is_descendant(const vert_t v, const vert_t w) const;
 
     std::string graph_stats() const { 
       if(opt.verb < 120) {
@@ -262,6 +356,13 @@ class impl_graph : public graph
 
     LinEqs fls_no() const;
     LinEqs fls_trivial() const; 
+    /**
+     * @brief computes trivial failed linerals, i.e., all common ancestors of v and SIGMA(v) for v in failing_v
+     * 
+     * @param failing_v verts v s.t. v and SIGMA(v) are reachable from the same root
+     * @return LinEqs failed linerals
+     */
+    LinEqs fls_trivial(const vec<vert_t>& failing_v) const;
     LinEqs fls_trivial_cc() const;
     LinEqs fls_full() const;
     //currently unused, as computationally expensive
@@ -39,7 +39,9 @@ int main(int argc, char const *argv[])
         #else
             out << "c crGCP only reduces LTs of vertices" << std::endl;
         #endif
-        #ifdef USE_TRIE
+        #if defined(USE_HCONS)
+            out << "c using hash-consed linerals for mapping vertices to linerals" << std::endl;
+        #elif defined(USE_TRIE)
             out << "c using trie for mapping vertices to linerals" << std::endl;
         #else
             out << "c using hashmaps for mapping vertices to linerals" << std::endl;
@@ -40,13 +40,41 @@
   #define VERB(lvl, msg)
 #endif
 
-#define SIGMA(i) (var_t)(((var_t) i) ^ ((var_t) 1))
-
-
 //type for variable numbering (16bit should suffice)
 typedef uint16_t var_t;
 //typedef uint_fast16_t var_t;
 
+//type for vertex numbering of the implication graph (each clause may create several verts, i.e., there can be many more verts than vars); set with cmake option VERT_T_BITS
+#ifndef VERT_T_BITS
+  #define VERT_T_BITS 32
+#endif
+#if VERT_T_BITS == 16
+  typedef uint16_t vert_t;
+#elif VERT_T_BITS == 32
+  typedef uint32_t vert_t;
+#elif VERT_T_BITS == 64
+  typedef uint64_t vert_t;
+#else
+  #error "VERT_T_BITS must be 16, 32 or 64"
+#endif
+
+//type for counting the edges of the implication graph; set with cmake option EDGE_CNT_T_BITS
+#ifndef EDGE_CNT_T_BITS
+  #define EDGE_CNT_T_BITS 32
+#endif
+#if EDGE_CNT_T_BITS == 16
+  typedef uint16_t edge_cnt_t;
+#elif EDGE_CNT_T_BITS == 32
+  typedef uint32_t edge_cnt_t;
+#elif EDGE_CNT_T_BITS == 64
+  typedef uint64_t edge_cnt_t;
+#else
+  #error "EDGE_CNT_T_BITS must be 16, 32 or 64"
+#endif
+
+//symmetric vert of vert i, i.e., the vert whose label is the label of i plus one
+#define SIGMA(i) (vert_t)(((vert_t) i) ^ ((vert_t) 1))
+
 
 //select vector impl to use
 template<class T>
@@ -96,7 +124,7 @@ class reordering {
  */
 struct options {
     var_t num_vars = 0;
-    var_t num_cls = 0;
+    edge_cnt_t num_cls = 0;
 
     dec_heu dh = dec_heu::mp;
     fls_alg fls = fls_alg::no;
@@ -117,10 +145,10 @@ struct options {
     //default settings
     options() : num_vars(0), num_cls(0) {};
     options(var_t n_vars) : num_vars(n_vars), num_cls(0) {};
-    options(var_t n_vars, var_t n_cls) : num_vars(n_vars), num_cls(n_cls) {};
-    options(var_t n_vars, var_t n_cls, dec_heu dh_, fls_alg fls_, upd_alg upd_, int verb_, int timeout_) : num_vars(n_vars), num_cls(n_cls), dh(dh_), fls(fls_), upd(upd_), verb(verb_), timeout(timeout_) {};
-    options(var_t n_vars, var_t n_cls, dec_heu dh_, fls_alg fls_, int fls_s_, upd_alg upd_, sc score_, constr ext_, preproc pp_, int verb_, int timeout_) : num_vars(n_vars), num_cls(n_cls), dh(dh_), fls(fls_), fls_s(fls_s_), upd(upd_), score(score_), ext(ext_), pp(pp_), verb(verb_), timeout(timeout_) {};
-    options(var_t n_vars, var_t n_cls, dec_heu dh_, fls_alg fls_, int fls_s_, upd_alg upd_, sc score_, constr ext_, preproc pp_, int verb_, int timeout_, reordering P_) : num_vars(n_vars), num_cls(n_cls), dh(dh_), fls(fls_), fls_s(fls_s_), upd(upd_), score(score_), ext(ext_), pp(pp_), verb(verb_), timeout(timeout_), P(P_) {};
+    options(var_t n_vars, edge_cnt_t n_cls) : num_vars(n_vars), num_cls(n_cls) {};
+    options(var_t n_vars, edge_cnt_t n_cls, dec_heu dh_, fls_alg fls_, upd_alg upd_, int verb_, int timeout_) : num_vars(n_vars), num_cls(n_cls), dh(dh_), fls(fls_), upd(upd_), verb(verb_), timeout(timeout_) {};
+    options(var_t n_vars, edge_cnt_t n_cls, dec_heu dh_, fls_alg fls_, int fls_s_, upd_alg upd_, sc score_, constr ext_, preproc pp_, int verb_, int timeout_) : num_vars(n_vars), num_cls(n_cls), dh(dh_), fls(fls_), fls_s(fls_s_), upd(upd_), score(score_), ext(ext_), pp(pp_), verb(verb_), timeout(timeout_) {};
+    options(var_t n_vars, edge_cnt_t n_cls, dec_heu dh_, fls_alg fls_, int fls_s_, upd_alg upd_, sc score_, constr ext_, preproc pp_, int verb_, int timeout_, reordering P_) : num_vars(n_vars), num_cls(n_cls), dh(dh_), fls(fls_), fls_s(fls_s_), upd(upd_), score(score_), ext(ext_), pp(pp_), verb(verb_), timeout(timeout_), P(P_) {};
 };
 
 
@@ -102,7 +102,7 @@ parsed_xnf parse_file(const std::string& fname) { reordering P; return parse_fil
 
 parsed_xnf parse_file_gp(const std::string &fname, const reordering& P) {
     var_t num_vars = 0;
-    var_t num_cls = 0;
+    edge_cnt_t num_cls = 0;
     
     vec< vec<lineral> > cls;
     vec< lineral > cl;
@@ -126,17 +126,19 @@ parsed_xnf parse_file_gp(const std::string &fname, const reordering& P) {
                 if (words.size()<4) {
                     std::cout << "c parser: file-format incorrectly specified. Should be \'p xnf n m\' where n is the number of variables and m the number of clauses." << std::endl;
                 }
-                num_vars = stoi(words[2]);
-                num_cls = stoi(words[3]);
-                //check bounds on no_vars and no_cls
-                if (num_vars-1 > std::numeric_limits<var_t>::max()) {
+                const long long n_vars = stoll(words[2]);
+                const long long n_cls = stoll(words[3]);
+                //check bounds on no_vars and no_cls (before they are truncated to var_t and edge_cnt_t)
+                if (n_vars-1 > std::numeric_limits<var_t>::max()) {
                     std::cout << "c parser: too many variables (use at most" << std::numeric_limits<var_t>::max() << " variables)" << std::endl;
                     throw std::runtime_error( "c too many variables" );
                 };
-                if (num_cls-1 > std::numeric_limits<var_t>::max()) {
-                    std::cout << "c parser: too many clauses (use at most" << std::numeric_limits<var_t>::max() << " clauses)" << std::endl;
-                    throw std::runtime_error( "c too many variables" );
+                if (n_cls-1 > (long long) std::numeric_limits<edge_cnt_t>::max()) {
+                    std::cout << "c parser: too many clauses (use at most" << std::numeric_limits<edge_cnt_t>::max() << " clauses)" << std::endl;
+                    throw std::runtime_error( "c too many clauses" );
                 };
+                num_vars = n_vars;
+                num_cls = n_cls;
             } else {
                 //line contains clause
                 cl.clear();
@@ -58,10 +58,10 @@ void write_str(const std::string& fname, const std::string& out);
 
 struct parsed_xnf {
     var_t num_vars;
-    var_t num_cls;
+    edge_cnt_t num_cls;
     vec< vec<lineral> > cls;
 
-    parsed_xnf(var_t _num_vars, var_t _num_cls, vec< vec<lineral> > _cls) : num_vars(_num_vars), num_cls(_num_cls), cls(_cls) {};
+    parsed_xnf(var_t _num_vars, edge_cnt_t _num_cls, vec< vec<lineral> > _cls) : num_vars(_num_vars), num_cls(_num_cls), cls(_cls) {};
     parsed_xnf(const parsed_xnf& o) : num_vars(o.num_vars), num_cls(o.num_cls), cls(o.cls) {};
 };
 
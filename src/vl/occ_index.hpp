@@ -0,0 +1,97 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include "../misc.hpp"
+
+
+/**
+ * @brief backtrackable occurrence index of vertex labels, i.e., maps each variable x to all vertices whose label contains x
+ * @note entries are never removed when a label changes, i.e., occ(x) may contain vertices whose current label no longer contains x (or that have no label at all); entries added since a saved state are removed on backtrack
+ */
+class occ_index {
+  private:
+    /**
+     * @brief occ[x] contains all vertices that were assigned a label containing x
+     */
+    vec< vec<vert_t> > occ;
+
+    /**
+     * @brief trail of variables x such that a vertex was appended to occ[x]
+     */
+    vec< var_t > trail;
+
+    const vec<vert_t> empty;
+
+  public:
+    occ_index() noexcept {};
+    occ_index(const occ_index& o) noexcept : occ(o.occ), trail(o.trail) {};
+    occ_index(occ_index&& o) noexcept : occ(std::move(o.occ)), trail(std::move(o.trail)) {};
+
+    /**
+     * @brief adds v to the occurrence list of x
+     * 
+     * @param v vertex
+     * @param x variable of the label of v; 0 (the constant) is ignored
+     */
+    inline void add(const vert_t v, const var_t x) {
+      if(x == 0) return;
+      if(x >= occ.size()) occ.resize(x+1);
+      occ[x].push_back(v);
+      trail.push_back(x);
+    };
+
+    /**
+     * @brief vertices whose label (possibly) contains x
+     * 
+     * @param x variable
+     * @return const vec<vert_t>& list of vertices
+     */
+    inline const vec<vert_t>& operator[](const var_t x) const noexcept { return x < occ.size() ? occ[x] : empty; };
+
+    inline size_t get_state() const noexcept { return trail.size(); };
+
+    /**
+     * @brief removes all entries added since the state was saved
+     * 
+     * @param trail_size saved state
+     * @param dl decision level to backtrack to; the trail is cleared if it is 0, as level-0 entries are never removed
+     */
+    void backtrack(const size_t trail_size, const var_t dl) noexcept {
+      assert(trail_size <= trail.size());
+      while(trail.size() > trail_size) {
+        occ[trail.back()].pop_back();
+        trail.pop_back();
+      }
+      if(dl == 0) trail.clear();
+    };
+
+    /**
+     * @brief removes all entries
+     */
+    void clear() noexcept {
+      occ.clear();
+      trail.clear();
+      trail.shrink_to_fit();
+    };
+
+    occ_index& operator =(const occ_index& o) noexcept { occ = o.occ; trail = o.trail; return *this; };
+    occ_index& operator =(occ_index&& o) noexcept { occ = std::move(o.occ); trail = std::move(o.trail); return *this; };
+};
@@ -20,10 +20,15 @@
 #pragma once
 
 #include "vl_hmap.hpp"
+#include "vl_conc.hpp"
 #include "vl_trie.hpp"
+#include "vl_hcons.hpp"
 
 
-#ifdef USE_TRIE
+#if defined(USE_HCONS)
+    typedef vl_hcons_repr vert_label_repr;
+    typedef vl_hcons vert_label;
+#elif defined(USE_TRIE)
     typedef trie_repr vert_label_repr;
     typedef vl_trie vert_label;
 #else
@@ -0,0 +1,87 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include "vl_hmap.hpp"
+
+/**
+ * @brief concurrent map from linerals to vertices that is filled by many threads at once
+ * @note writes only lock the submap of the inserted lineral, reads do not lock at all -- hence reads must not run concurrently with writes.
+ * If a lineral is inserted with several vertices, the one with the smallest priority is kept, independent of the order of insertion.
+ */
+class vl_conc
+{
+  private:
+    /**
+     * @brief map from linerals to vertices
+     */
+    hmap<lineral, vert_t> xl_to_v;
+
+    /**
+     * @brief prio[v] is the priority of vertex v; must be set before v is inserted
+     */
+    const vec<vert_t>& prio;
+
+  public:
+    vl_conc(const vert_t num_verts, const vec<vert_t>& _prio) noexcept : xl_to_v(num_verts), prio(_prio) {};
+
+    ~vl_conc() {};
+
+    /**
+     * @brief inserts lit with vertex v, or replaces the vertex of lit by v if v has smaller priority; thread-safe
+     * 
+     * @param v vertex
+     * @param lit lineral of v
+     * @return true iff lit was not present yet
+     */
+    inline bool insert(const vert_t v, const lineral& lit) {
+      return xl_to_v.try_emplace_l(lit, [this,v](auto& kv) { if(prio[v] < prio[kv.second]) kv.second = v; }, v);
+    };
+
+    /**
+     * @brief retrieves vertex of lit without locking; must not be called concurrently with insert
+     * 
+     * @param lit lineral to search vertex of
+     * @return vert_t vertex of lit with smallest priority
+     */
+    inline vert_t at(const lineral& lit) const {
+      vert_t v = 0;
+      [[maybe_unused]] const bool found = xl_to_v.if_contains_unsafe(lit, [&v](const auto& kv) { v = kv.second; });
+      assert(found);
+      return v;
+    };
+
+    /**
+     * @brief check if given lineral has a vertex without locking; must not be called concurrently with insert
+     * 
+     * @param lit lineral to check containment
+     * @return true iff lit was inserted
+     */
+    inline bool contains(const lineral& lit) const { return xl_to_v.if_contains_unsafe(lit, [](const auto&) {}); };
+
+    inline vert_t size() const noexcept { return xl_to_v.size(); };
+
+    /**
+     * @brief moves the stored map out of the object
+     * 
+     * @return hmap<lineral,vert_t> map from linerals to the vertices with smallest priority
+     */
+    inline hmap<lineral,vert_t> extract() noexcept { return std::move(xl_to_v); };
+};
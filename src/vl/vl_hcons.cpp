@@ -0,0 +1,117 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "vl_hcons.hpp"
+
+#include <algorithm>
+
+
+void vl_hcons::backtrack(vl_hcons_repr&& r, const var_t dl) noexcept {
+    assert(r.trail_size <= trail.size());
+    //undo changes in reverse order
+    while(trail.size() > r.trail_size) {
+        const auto [v,id] = trail.back();
+        trail.pop_back();
+        if(id == NO_LID) {
+            //v was assigned
+            idx_v.erase( v_lid[v] >> 1 );
+            v_lid[v] = NO_LID;
+            num_vs--;
+        } else {
+            //v was erased
+            v_lid[v] = id;
+            idx_v[id >> 1] = v;
+            num_vs++;
+        }
+    }
+    //level-0 changes are never undone
+    if(dl == 0) trail.clear();
+    occ.backtrack(r.occ_size, dl);
+    //all remaining labels were interned before r was saved
+    store.truncate(r.store_size);
+};
+
+
+const hcons_insert_return_type vl_hcons::insert(const vert_t v, const lineral& lit, [[maybe_unused]] const var_t dl) {
+    if( contains(v) ) return hcons_insert_return_type(false, false, v);
+
+    const lid_t id = store.intern(lit);
+    const auto search = idx_v.find(id >> 1);
+    if(search != idx_v.end()) {
+        //lit or lit+1 is already the label of some vertex
+        const vert_t w = search->second;
+        return hcons_insert_return_type(false, v_lid[w] != id, w);
+    }
+    assign_vert(v, id);
+    return hcons_insert_return_type(true, false, v);
+};
+
+bool vl_hcons::erase(const vert_t v) {
+    assert( contains(v) );
+    if(!contains(v)) return false;
+    trail.emplace_back(v, v_lid[v]);
+    idx_v.erase( v_lid[v] >> 1 );
+    v_lid[v] = NO_LID;
+    num_vs--;
+    return true;
+};
+
+std::pair<vert_t,bool> vl_hcons::update(const vert_t v, const lineral& l, const var_t dl) {
+    assert(contains(v));
+    [[maybe_unused]] bool erased = erase(v);
+    assert(erased);
+    auto ins = insert(v, l, dl);
+    return { ins.inserted ? v : ins.vert, ins.found_plus_one };
+};
+
+lid_t vl_hcons::gc() {
+    const lid_t num_lits_before = store.size();
+    lineral_store new_store;
+    idx_v.clear();
+    occ.clear();
+    for(vert_t v = 0; v < v_lid.size(); ++v) {
+        if(v_lid[v] == NO_LID) continue;
+        v_lid[v] = new_store.intern( store.get(v_lid[v]) );
+        idx_v[v_lid[v] >> 1] = v;
+        for(const auto& x : new_store.get_(v_lid[v]).get_idxs_()) occ.add(v, x);
+    }
+    store = std::move(new_store);
+    //level-0 changes are never undone
+    trail.clear();
+    trail.shrink_to_fit();
+    return num_lits_before - store.size();
+};
+
+lineral vl_hcons::sum(const vert_t lhs, const vert_t rhs) const {
+    assert(contains(lhs) && contains(rhs));
+    if(!omp_in_parallel()) return store.get( store.sum(v_lid[lhs], v_lid[rhs]) );
+    lineral l = store.get_(v_lid[lhs]) + store.get_(v_lid[rhs]);
+    if((v_lid[lhs] ^ v_lid[rhs]) & 1) l.add_one();
+    return l;
+};
+
+std::string vl_hcons::to_str() const {
+    std::string str = "";
+    for(vert_t v = 0; v < v_lid.size(); ++v) {
+        if(v_lid[v] == NO_LID) continue;
+        str += "(" + std::to_string(v) + "," + store.get(v_lid[v]).to_str() + ") ";
+    }
+    if(str.size() > 0) str.pop_back();
+    return str;
+};
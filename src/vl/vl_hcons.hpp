@@ -0,0 +1,348 @@
+// Copyright (c) 2022-2024 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "../misc.hpp"
+#include "../LA/lineral.hpp"
+#include "../LA/lineral_store.hpp"
+#include "occ_index.hpp"
+
+#include "../robin_hood-3.11.5/robin_hood.h"
+
+
+struct hcons_insert_return_type {
+    const bool inserted;
+    const bool found_plus_one;
+    const vert_t vert;
+
+    hcons_insert_return_type(const bool& _inserted, const bool& _found_plus_one, const vert_t _vert) : inserted(_inserted), found_plus_one(_found_plus_one), vert(_vert) {};
+    ~hcons_insert_return_type() {};
+};
+
+struct vl_hcons_repr {
+  /**
+   * @brief size of the trail when the state was saved
+   */
+  const size_t trail_size = 0;
+
+  /**
+   * @brief number of interned linerals when the state was saved
+   */
+  const lid_t store_size = 1;
+
+  /**
+   * @brief state of the occurrence index when the state was saved
+   */
+  const size_t occ_size = 0;
+
+  vl_hcons_repr() noexcept {};
+  vl_hcons_repr(const vl_hcons_repr& o) noexcept : trail_size(o.trail_size), store_size(o.store_size), occ_size(o.occ_size) {};
+  vl_hcons_repr(vl_hcons_repr&& o) noexcept : trail_size(o.trail_size), store_size(o.store_size), occ_size(o.occ_size) {};
+  vl_hcons_repr(const size_t _trail_size, const lid_t _store_size, const size_t _occ_size) noexcept : trail_size(_trail_size), store_size(_store_size), occ_size(_occ_size) {};
+  ~vl_hcons_repr() {};
+};
+
+
+/**
+ * @brief vertex labels as ids of hash-consed linerals, i.e., every lineral (up to its constant) is stored once in a lineral_store; equality checks and lookups are id operations
+ * @note same interface and semantics as vl_trie: a vertex v is labelled with l iff SIGMA(v) is (implicitly) labelled with l+1, and at most one of l and l+1 is stored
+ */
+class vl_hcons
+{
+  private:
+    /**
+     * @brief interned linerals; mutable as sums are memoized
+     */
+    mutable lineral_store store;
+
+    /**
+     * @brief v_lid[v] is lid_t of the label of vertex v, NO_LID if it has none
+     */
+    vec<lid_t> v_lid;
+
+    /**
+     * @brief maps index of lineral (i.e. lid_t without constant) to the vertex it labels
+     */
+    robin_hood::unordered_flat_map<lid_t, vert_t> idx_v;
+
+    /**
+     * @brief number of labelled vertices
+     */
+    vert_t num_vs = 0;
+
+    /**
+     * @brief trail of changes of v_lid, i.e., pairs (v,id) where id is the lid_t of v before the change, NO_LID if v had none
+     * @note undone in reverse order by backtrack
+     */
+    vec< std::pair<vert_t,lid_t> > trail;
+
+    /**
+     * @brief occurrence index of the labels
+     */
+    occ_index occ;
+
+    inline void assign_vert(const vert_t v, const lid_t id) {
+      if(v >= v_lid.size()) v_lid.resize(v+1, NO_LID);
+      v_lid[v] = id;
+      idx_v[id >> 1] = v;
+      num_vs++;
+      trail.emplace_back(v, NO_LID);
+      for(const auto& x : store.get_(id).get_idxs_()) occ.add(v, x);
+    };
+
+    /**
+     * @brief lid_t of the stored lineral equal to l or l+1
+     * 
+     * @param l lineral
+     * @return lid_t id of l, NO_LID if neither l nor l+1 is a label
+     */
+    inline lid_t find(const lineral& l) const {
+      const lid_t id = store.find(l);
+      return (id != NO_LID && idx_v.contains(id >> 1)) ? id : NO_LID;
+    };
+
+  public:
+    vl_hcons() noexcept {};
+
+    vl_hcons([[maybe_unused]] const var_t _num_vars) noexcept {};
+
+    vl_hcons(const vert_t num_verts, [[maybe_unused]] const var_t _num_vars) noexcept { v_lid.reserve(num_verts); idx_v.reserve(num_verts/2); };
+
+    vl_hcons(const vl_hcons& o) noexcept : store(o.store), v_lid(o.v_lid), idx_v(o.idx_v), num_vs(o.num_vs), trail(o.trail), occ(o.occ) {};
+
+    vl_hcons(vl_hcons&& o) noexcept : store(std::move(o.store)), v_lid(std::move(o.v_lid)), idx_v(std::move(o.idx_v)), num_vs(o.num_vs), trail(std::move(o.trail)), occ(std::move(o.occ)) {};
+
+    ~vl_hcons() {};
+
+    vl_hcons_repr get_state() const { return vl_hcons_repr(trail.size(), store.size(), occ.get_state()); };
+
+    /**
+     * @brief restores the vertex labels of a saved state by undoing the changes on the trail since then, and drops all linerals interned since then
+     * 
+     * @param r saved state
+     * @param dl decision level to backtrack to; the trail is cleared if it is 0, as level-0 changes are never undone
+     */
+    void backtrack(vl_hcons_repr&& r, const var_t dl) noexcept;
+
+    inline vert_t size() const noexcept { return num_vs; };
+
+    /**
+     * @brief number of interned linerals
+     */
+    inline lid_t get_num_linerals() const noexcept { return store.size(); };
+
+    /**
+     * @brief rebuilds the store from the labels of the stored vertices only
+     * @note must only be called at decision level 0, as the ids of all labels change
+     * 
+     * @return lid_t number of freed linerals
+     */
+    lid_t gc();
+
+    /**
+     * @brief checks whether gc is worth its cost, i.e., whether the store holds more than twice as many linerals as there are labels
+     * 
+     * @return true iff gc should be called
+     */
+    inline bool gc_due() const noexcept { return store.size() > 2*(num_vs+16); };
+
+    /**
+     * @brief vertices whose label contains x; may also contain vertices whose label no longer contains x or that have no label at all
+     * 
+     * @param x variable
+     * @return const vec<vert_t>& list of vertices
+     */
+    inline const vec<vert_t>& get_occ(const var_t x) const noexcept { return occ[x]; };
+
+    /**
+     * @brief inserts lit if neither lit nor lit+1 is present
+     * 
+     * @param v vertex index
+     * @param lit lineral to be inserted
+     * @param dl current decision level
+     * @return hcons_insert_return_type field inserted is true iff lit could be assigned to v; field vert is the vertex of lit (or lit+1, then found_plus_one is true)
+     */
+    const hcons_insert_return_type insert(const vert_t v, const lineral& lit, const var_t dl);
+
+    /**
+     * @brief erase label of vertex v
+     * 
+     * @param v vertex to be removed
+     * @return true iff vert could be erased
+     */
+    bool erase(const vert_t v);
+
+    /**
+     * @brief updates lit assigned to v to l
+     * 
+     * @param v vertex to update
+     * @param l label to change to
+     * @param dl current decision level
+     * @return vert_t vert where lit is stored (or lit+1); bool true iff vert points to lit+1
+     */
+    std::pair<vert_t,bool> update(const vert_t v, const lineral& l, const var_t dl);
+
+    /**
+     * @brief retrieves lineral of vertex
+     * 
+     * @param v vertex to search literal of
+     * @return lineral literal of vertex v
+     */
+    inline lineral at(const vert_t v) const {
+      if(!contains(v)) throw std::out_of_range("Label of vertex " + std::to_string(v) + " not found.");
+      return store.get(v_lid[v]);
+    };
+
+    /**
+     * @brief retrieves lineral of vertex
+     * 
+     * @param v vertex to search literal of
+     * @return lineral literal of vertex v
+     */
+    inline lineral operator[](const vert_t v) const { return at(v); };
+
+    /**
+     * @brief retrieves vertex of lit
+     * 
+     * @param lit literal to search vertex of
+     * @return vert_t vertex of lit; 0 if there is none!
+     */
+    inline vert_t operator[](const lineral& lit) const { return contains(lit) ? idx_v.at(store.find(lit) >> 1) : 0; };
+
+    /**
+     * @brief retrieves vertex of lit
+     * 
+     * @param lit literal to search vertex of
+     * @return vert_t vertex of lit;
+     */
+    inline vert_t at(const lineral& lit) const {
+      if(!contains(lit)) throw std::out_of_range("Vertex of label " + lit.to_str() + " not found.");
+      return idx_v.at(store.find(lit) >> 1);
+    };
+
+    /**
+     * @brief retrieves vertex of lit or lit+1
+     * 
+     * @param lit literal to search vertex of
+     * @return vert_t vertex of lit (or lit+1); bool true iff lit was found
+     */
+    inline std::pair<vert_t,bool> at_(const lineral& lit) const {
+      const lid_t id = find(lit);
+      if(id == NO_LID) throw std::out_of_range("Vertex of label " + lit.to_str() + " not found.");
+      const vert_t v = idx_v.at(id >> 1);
+      return {v, v_lid[v] == id};
+    };
+
+    /**
+     * @brief compute string repr of object, listing all stored pairs (v, lit) sorted by vertex
+     * 
+     * @return std::string representation of object
+     */
+    std::string to_str() const;
+
+    /**
+     * @brief check if given literal is the label of some vertex
+     * 
+     * @param lit literal to check containment
+     * @return true iff literal has vert
+     */
+    inline bool contains(const lineral& lit) const {
+      const lid_t id = find(lit);
+      return id != NO_LID && v_lid[ idx_v.at(id >> 1) ] == id;
+    };
+
+    /**
+     * @brief check if given vert has a label
+     * 
+     * @param v vert to check containment
+     * @return true iff vert has label
+     */
+    inline bool contains(const vert_t v) const { return v < v_lid.size() && v_lid[v] != NO_LID; };
+
+    inline vert_t V(const lineral &l) const {
+      const auto [v,b] = at_(l);
+      //b is true if l was found at v; otherwise l+1 was found at v.
+      return b ? v : SIGMA(v);
+    }
+
+    //check if V contains l or l+1
+    inline bool V_contains(const lineral &l) const { return find(l) != NO_LID; }
+
+    inline bool Vxlit_contains(const vert_t &v) const { return contains(v); }
+
+    /**
+     * @brief lid_t of the label of v
+     * 
+     * @param v vertex such that v or SIGMA(v) is labelled
+     * @return lid_t id of label of v
+     */
+    inline lid_t Vxlit_id(const vert_t &v) const {
+      assert( contains(v) || contains(SIGMA(v)) );
+      return contains(v) ? v_lid[v] : (v_lid[SIGMA(v)] ^ 1);
+    }
+
+    inline lineral Vxlit(const vert_t &v) const { return store.get( Vxlit_id(v) ); }
+
+    inline var_t Vxlit_LT(const vert_t &v) const { return store.LT( Vxlit_id(v) ); }
+
+    /**
+     * @brief returns a tuple allowing to find the vertex representing zero - if it exists
+     * 
+     * @return std::tuple<bool,bool,vert_t> 1st bool true if zero exists; 2nd bool true iff 1 was found; 3rd vert_t vertex found
+     */
+    std::tuple<bool,bool,vert_t> if_exists_get_zero_v() const {
+      const auto search = idx_v.find(LID_ZERO >> 1);
+      if(search == idx_v.end()) return {false, false, -1};
+      return {true, v_lid[search->second] != LID_ZERO, search->second};
+    }
+
+    /**
+     * @brief sum of the labels of two vertices; memoized in the store
+     * @note the memo is bypassed inside parallel regions, as interning is not thread-safe
+     * 
+     * @param lhs labelled vertex
+     * @param rhs labelled vertex
+     * @return lineral sum of labels of lhs and rhs
+     */
+    lineral sum(const vert_t lhs, const vert_t rhs) const;
+
+    vl_hcons& operator =(const vl_hcons& o) noexcept {
+      store = o.store;
+      v_lid = o.v_lid;
+      idx_v = o.idx_v;
+      num_vs = o.num_vs;
+      trail = o.trail;
+      occ = o.occ;
+      return *this;
+    };
+
+    vl_hcons& operator =(vl_hcons&& o) noexcept {
+      store = std::move(o.store);
+      v_lid = std::move(o.v_lid);
+      idx_v = std::move(o.idx_v);
+      num_vs = o.num_vs;
+      trail = std::move(o.trail);
+      occ = std::move(o.occ);
+      return *this;
+    };
+};
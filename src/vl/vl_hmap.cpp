@@ -21,24 +21,29 @@
 #include "vl_hmap.hpp"
 
 
-const vl_hmap_insert_return_type vl_hmap::insert(const var_t v, lineral&& lit, [[maybe_unused]] const var_t dl) {
+const vl_hmap_insert_return_type vl_hmap::insert(const vert_t v, lineral&& lit, [[maybe_unused]] const var_t dl) {
     assert(!lit.has_constant());
-    auto inserted = xl_to_v_stack.top().emplace( lit, v );
+    auto inserted = xl_to_v.emplace( lit, v );
     if(inserted.second) {
-        [[maybe_unused]] auto inserted2 = v_to_xl_stack.top().emplace( v, std::move(lit) ); 
+        [[maybe_unused]] auto inserted2 = v_to_xl.emplace( v, std::move(lit) ); 
         assert(inserted2.second);
+        log.emplace_back( v, false, lineral() );
     }
     return vl_hmap_insert_return_type(inserted.second, inserted.second ? v : (inserted.first)->second);
 };
 
-bool vl_hmap::erase(const var_t v) {
-    bool erased = xl_to_v_stack.top().erase( v_to_xl_stack.top().at(v) );
-    bool erased2 = v_to_xl_stack.top().erase( v );
-    assert(erased && erased2);
-    return erased && erased2;
+bool vl_hmap::erase(const vert_t v) {
+    auto search = v_to_xl.find( v );
+    assert(search != v_to_xl.end());
+    if(search == v_to_xl.end()) return false;
+    [[maybe_unused]] bool erased = xl_to_v.erase( search->second );
+    assert(erased);
+    log.emplace_back( v, true, std::move(search->second) );
+    v_to_xl.erase( search );
+    return true;
 };
 
-std::pair<var_t,bool> vl_hmap::update(const var_t v, lineral&& l, const var_t dl) {
+std::pair<vert_t,bool> vl_hmap::update(const vert_t v, lineral&& l, const var_t dl) {
     [[maybe_unused]] bool erased = erase( v );
     assert(erased);
     bool found_plus_one = false;
@@ -50,10 +55,49 @@ std::pair<var_t,bool> vl_hmap::update(const var_t v, lineral&& l, const var_t dl
     return { ins.inserted ? v : ins.vert, found_plus_one};
 };
 
+void vl_hmap::put(hmap<vert_t,lineral>&& new_v_to_xl, hmap<lineral,vert_t>&& new_xl_to_v) noexcept {
+    //log changed labels as erasures of all old labels followed by insertions of all new labels
+    vec<vert_t> inserted;
+    size_t num_unchanged = 0;
+    for(auto& [v,l] : v_to_xl) {
+        const auto search = new_v_to_xl.find( v );
+        if(search != new_v_to_xl.end() && search->second == l) { ++num_unchanged; continue; }
+        if(search != new_v_to_xl.end()) inserted.push_back( v );
+        log.emplace_back( v, true, std::move(l) );
+    }
+    //vertices that were not labelled before (e.g. SIGMA(v) of a labelled v) require a second pass
+    if(num_unchanged + inserted.size() < new_v_to_xl.size()) {
+        for(const auto& [v,l] : new_v_to_xl) if(!v_to_xl.contains(v)) inserted.push_back( v );
+    }
+    assert(num_unchanged + inserted.size() == new_v_to_xl.size());
+    for(const auto& v : inserted) log.emplace_back( v, false, lineral() );
+    v_to_xl = std::move(new_v_to_xl);
+    xl_to_v = std::move(new_xl_to_v);
+};
+
+void vl_hmap::backtrack(vl_hmap_repr&& r, const var_t dl) noexcept {
+    assert(r.log_size <= log.size());
+    //undo changes in reverse order
+    while(log.size() > r.log_size) {
+        auto& c = log.back();
+        if(c.erased) {
+            xl_to_v.emplace( c.l, c.v );
+            v_to_xl.emplace( c.v, std::move(c.l) );
+        } else {
+            const auto search = v_to_xl.find( c.v );
+            assert(search != v_to_xl.end());
+            xl_to_v.erase( search->second );
+            v_to_xl.erase( search );
+        }
+        log.pop_back();
+    }
+    //level-0 changes are never undone
+    if(dl == 0) log.clear();
+};
 
 std::string vl_hmap::to_str() const {
     std::string str = "";
-    for(const auto& [v,l] : v_to_xl_stack.top()) {
+    for(const auto& [v,l] : v_to_xl) {
         str += "(" + std::to_string(v) + "," + l.to_str() + ") ";
     }
     if(str.size() > 0) str.pop_back();
@@ -40,16 +40,39 @@ using hmap = phmap::parallel_flat_hash_map<K, V,
                                           std::mutex>;
 
 struct vl_hmap_repr {
-  var_t lvl;
+  /**
+   * @brief size of the change log when the state was saved
+   */
+  size_t log_size;
 
-  vl_hmap_repr(const var_t _lvl) noexcept : lvl(_lvl) {};
+  vl_hmap_repr(const size_t _log_size) noexcept : log_size(_log_size) {};
+};
+
+/**
+ * @brief entry of the change log of vl_hmap
+ */
+struct vl_hmap_change {
+  /**
+   * @brief changed vertex
+   */
+  vert_t v;
+  /**
+   * @brief true iff (v,l) was erased, false iff v was inserted
+   */
+  bool erased;
+  /**
+   * @brief label of v before it was erased; empty if v was inserted
+   */
+  lineral l;
+
+  vl_hmap_change(const vert_t _v, const bool _erased, lineral&& _l) noexcept : v(_v), erased(_erased), l(std::move(_l)) {};
 };
 
 struct vl_hmap_insert_return_type {
     const bool inserted;
-    const var_t vert;
+    const vert_t vert;
 
-    vl_hmap_insert_return_type(const bool& _inserted, const var_t _vert) : inserted(_inserted), vert(_vert) {};
+    vl_hmap_insert_return_type(const bool& _inserted, const vert_t _vert) : inserted(_inserted), vert(_vert) {};
     ~vl_hmap_insert_return_type() {};
 };
 
@@ -59,46 +82,82 @@ class vl_hmap
     /**
      * @brief map from vertices to linerals
      */
-    std::stack< hmap<var_t, lineral> > v_to_xl_stack;
+    hmap<vert_t, lineral> v_to_xl;
 
     /**
-     * @brief map from linerals to vertices
+     * @brief map from linerals to vertices; inverse of v_to_xl
      */
-    std::stack< hmap<lineral, var_t> > xl_to_v_stack;
+    hmap<lineral, vert_t> xl_to_v;
+
+    /**
+     * @brief log of all insertions and erasures, undone in reverse order by backtrack
+     */
+    vec< vl_hmap_change > log;
 
   public:
     vl_hmap() noexcept : vl_hmap(1) {};
 
-    vl_hmap(const var_t _num_verts) noexcept : v_to_xl_stack(std::stack< hmap<var_t,lineral> >()), xl_to_v_stack(std::stack< hmap<lineral,var_t> >()) {
-        v_to_xl_stack.emplace( hmap<var_t,lineral>(_num_verts) );
-        xl_to_v_stack.emplace( hmap<lineral,var_t>(_num_verts) );
-    };
+    vl_hmap(const vert_t _num_verts) noexcept : v_to_xl(_num_verts), xl_to_v(_num_verts) {};
     
-    vl_hmap(const var_t _num_verts, [[maybe_unused]] const var_t _num_vars) noexcept : vl_hmap(_num_verts)  {};
+    vl_hmap(const vert_t _num_verts, [[maybe_unused]] const var_t _num_vars) noexcept : vl_hmap(_num_verts)  {};
 
-    vl_hmap(const vl_hmap& vl) noexcept : v_to_xl_stack(vl.v_to_xl_stack), xl_to_v_stack(vl.xl_to_v_stack) {};
+    vl_hmap(const vl_hmap& vl) noexcept : v_to_xl(vl.v_to_xl), xl_to_v(vl.xl_to_v), log(vl.log) {};
     
-    vl_hmap(vl_hmap&& vl) noexcept : v_to_xl_stack(std::move(vl.v_to_xl_stack)), xl_to_v_stack(std::move(vl.xl_to_v_stack)) {};
+    vl_hmap(vl_hmap&& vl) noexcept : v_to_xl(std::move(vl.v_to_xl)), xl_to_v(std::move(vl.xl_to_v)), log(std::move(vl.log)) {};
     
     ~vl_hmap() {};
 
-    inline void put_Vxlit(hmap<var_t,lineral>&& _Vxlit) noexcept { v_to_xl_stack.top() = std::move(_Vxlit); };
-    inline void put_V(hmap<lineral,var_t>&& _V) noexcept { xl_to_v_stack.top() = std::move(_V); };
+    /**
+     * @brief replaces all labels by the given ones; only labels that differ are logged
+     * 
+     * @param new_v_to_xl new map from vertices to linerals
+     * @param new_xl_to_v new map from linerals to vertices; must be inverse of new_v_to_xl
+     */
+    void put(hmap<vert_t,lineral>&& new_v_to_xl, hmap<lineral,vert_t>&& new_xl_to_v) noexcept;
 
-    inline vl_hmap_repr get_state() {
-      v_to_xl_stack.push( v_to_xl_stack.top() );
-      xl_to_v_stack.push( xl_to_v_stack.top() );
-      return vl_hmap_repr(v_to_xl_stack.size());
-    };
+    inline vl_hmap_repr get_state() const { return vl_hmap_repr(log.size()); };
     
-    inline void backtrack(vl_hmap_repr&& r, [[maybe_unused]] const var_t dl) noexcept {
-      while(xl_to_v_stack.size()>=r.lvl) {
-        xl_to_v_stack.pop();
-        v_to_xl_stack.pop();
+    /**
+     * @brief restores the labels of a saved state by undoing the logged changes since then
+     * 
+     * @param r saved state
+     * @param dl decision level to backtrack to; the log is cleared if it is 0, as level-0 changes are never undone
+     * @note complexity is linear in the number of changes since r was saved
+     */
+    void backtrack(vl_hmap_repr&& r, const var_t dl) noexcept;
+
+    inline vert_t size() const noexcept { return xl_to_v.size(); };
+
+    /**
+     * @brief shrinks the hash maps to fit the stored labels; they never shrink on erase
+     * @note should only be called at decision level 0
+     * 
+     * @return size_t number of freed slots
+     */
+    inline size_t gc() {
+      const size_t cap_before = v_to_xl.capacity() + xl_to_v.capacity();
+      //note: rehash(0) of phmap may leave a table without empty slots, hence we move the labels to fresh maps instead
+      hmap<vert_t,lineral> v_to_xl_(size());
+      hmap<lineral,vert_t> xl_to_v_(size());
+      for(auto& [v,l] : v_to_xl) {
+        xl_to_v_.emplace(l, v);
+        v_to_xl_.emplace(v, std::move(l));
       }
+      v_to_xl = std::move(v_to_xl_);
+      xl_to_v = std::move(xl_to_v_);
+      //level-0 changes are never undone
+      log.clear();
+      log.shrink_to_fit();
+      const size_t cap_after = v_to_xl.capacity() + xl_to_v.capacity();
+      return cap_before > cap_after ? cap_before - cap_after : 0;
     };
 
-    inline var_t size() const noexcept { return xl_to_v_stack.top().size(); };
+    /**
+     * @brief checks whether gc is worth its cost, i.e., whether the hash maps are mostly empty
+     * 
+     * @return true iff gc should be called
+     */
+    inline bool gc_due() const noexcept { return v_to_xl.capacity() > 4*((size_t) size()+16); };
 
     /**
      * @brief inserts lit if not yet present
@@ -108,7 +167,7 @@ class vl_hmap
      * @param dl current decision level
      * @return vl_hmap_insert_return_type field inserted is true iff lit could be assigned to v; field vert points to the vertex representing lit
      */
-    const vl_hmap_insert_return_type insert(const var_t v, lineral&& lit, const var_t dl);
+    const vl_hmap_insert_return_type insert(const vert_t v, lineral&& lit, const var_t dl);
 
     /**
      * @brief erase vertex v from trie (along with its label)
@@ -116,7 +175,7 @@ class vl_hmap
      * @param v vertex to be removed
      * @return true iff vert could be erased
      */
-    bool erase(const var_t v);
+    bool erase(const vert_t v);
 
     /**
      * @brief updates lit assigned to v to l
@@ -124,9 +183,9 @@ class vl_hmap
      * @param v vertex to update
      * @param l label to change to
      * @param dl current decision level - if not provided defaults to 0
-     * @return var_t vert where lit is stored (or lit+1); bool true iff vert points to lit+1
+     * @return vert_t vert where lit is stored (or lit+1); bool true iff vert points to lit+1
      */
-    std::pair<var_t,bool> update(const var_t v, lineral&& l, const var_t dl);
+    std::pair<vert_t,bool> update(const vert_t v, lineral&& l, const var_t dl);
 
     /**
      * @brief retrieves lineral of vertex
@@ -135,16 +194,16 @@ class vl_hmap
      * @note complexity is linear in size of literal to be found (if there is none, constant)
      * @return lineral literal of vertex v
      */
-    inline lineral operator[](const var_t v) const noexcept { return v_to_xl_stack.top().at(v); };
+    inline lineral operator[](const vert_t v) const noexcept { return v_to_xl.at(v); };
 
     /**
      * @brief retrieves vertex of lit
      * 
      * @param lit literal to search vertex of
      * @note complexity is amortized linear in lit.get_idxs().size()
-     * @return var_t vertex of lit; 0 if there is none!
+     * @return vert_t vertex of lit; 0 if there is none!
      */
-    inline var_t operator[](const lineral& lit) const noexcept { return xl_to_v_stack.top().at(lit); };
+    inline vert_t operator[](const lineral& lit) const noexcept { return xl_to_v.at(lit); };
 
     /**
      * @brief compute string repr of object, listing all stored pairs (v, lit) in sorted order.
@@ -159,7 +218,7 @@ class vl_hmap
      * @param lit literal to check containment
      * @return true iff literal has vert in trie
      */
-    inline bool contains(const lineral& lit) const noexcept { return xl_to_v_stack.top().contains(lit); };
+    inline bool contains(const lineral& lit) const noexcept { return xl_to_v.contains(lit); };
     
     /**
      * @brief check if given vert has a corr literal
@@ -167,65 +226,76 @@ class vl_hmap
      * @param v vert to check containment
      * @return true iff vert has literal
      */
-    inline bool contains(const var_t v) const noexcept { return v_to_xl_stack.top().contains(v); };
+    inline bool contains(const vert_t v) const noexcept { return v_to_xl.contains(v); };
 
 
     //#define V(l) V_stack.top().at(l)
-    inline var_t V(const lineral &l) const {
+    inline vert_t V(const lineral &l) const {
       if(!l.has_constant()) {
-        auto search = xl_to_v_stack.top().find( l );
-        assert(search != xl_to_v_stack.top().end());
+        auto search = xl_to_v.find( l );
+        assert(search != xl_to_v.end());
         return search->second;
       } else {
-        return SIGMA( xl_to_v_stack.top().find( l.plus_one() )->second );
+        return SIGMA( xl_to_v.find( l.plus_one() )->second );
       }
     }
 
     //check if V contains l
     inline bool V_contains(const lineral &l) const {
       if(!l.has_constant()) {
-        return xl_to_v_stack.top().contains( l );
+        return xl_to_v.contains( l );
       } else {
-        return xl_to_v_stack.top().contains( l.plus_one() );
+        return xl_to_v.contains( l.plus_one() );
       }
     }
 
-    //#define v_to_xl(v) v_to_xl_stack.top().at(v)
-    inline lineral Vxlit(const var_t &v) const {
-      auto search = v_to_xl_stack.top().find( v );
-      if(search == v_to_xl_stack.top().end()) {
-        auto sigma_search = v_to_xl_stack.top().find( SIGMA(v) );
-        assert(sigma_search != v_to_xl_stack.top().end());
+    //#define v_to_xl(v) v_to_xl.at(v)
+    inline lineral Vxlit(const vert_t &v) const {
+      auto search = v_to_xl.find( v );
+      if(search == v_to_xl.end()) {
+        auto sigma_search = v_to_xl.find( SIGMA(v) );
+        assert(sigma_search != v_to_xl.end());
         return (sigma_search->second).plus_one(); //TODO avoid copy!
       } else {
         return search->second;
       }
     }
 
-    inline bool Vxlit_contains(const var_t &v) const {
-      auto search = v_to_xl_stack.top().find( v );
-      if(search == v_to_xl_stack.top().end()) {
-        return v_to_xl_stack.top().find( SIGMA(v) ) != v_to_xl_stack.top().end(); //TODO avoid copy!
+    /**
+     * @brief copies the lineral of v to l if there is one, without locking; must not be called concurrently with any modification
+     * 
+     * @param v vertex
+     * @param l lineral to copy to
+     * @return true iff v has a lineral
+     */
+    inline bool Vxlit_if_contains_unsafe(const vert_t v, lineral& l) const { return v_to_xl.if_contains_unsafe(v, [&l](const auto& kv) { l = kv.second; }); };
+
+    inline bool Vxlit_contains(const vert_t &v) const {
+      auto search = v_to_xl.find( v );
+      if(search == v_to_xl.end()) {
+        return v_to_xl.find( SIGMA(v) ) != v_to_xl.end(); //TODO avoid copy!
       } else {
         return true;
       }
     }
 
-    inline var_t Vxlit_LT(const var_t &v) const {
-      return v_to_xl_stack.top().at( contains(v) ? v : SIGMA(v) ).LT();
+    inline var_t Vxlit_LT(const vert_t &v) const {
+      return v_to_xl.at( contains(v) ? v : SIGMA(v) ).LT();
     }
 
     vl_hmap& operator =(vl_hmap& o) noexcept {
-      v_to_xl_stack = o.v_to_xl_stack;
-      xl_to_v_stack = o.xl_to_v_stack;
+      v_to_xl = o.v_to_xl;
+      xl_to_v = o.xl_to_v;
+      log = o.log;
       return *this;
     };
 
-    vl_hmap& operator =(const vl_hmap&& o) noexcept {
-      v_to_xl_stack = std::move(o.v_to_xl_stack);
-      xl_to_v_stack = std::move(o.xl_to_v_stack);
+    vl_hmap& operator =(vl_hmap&& o) noexcept {
+      v_to_xl = std::move(o.v_to_xl);
+      xl_to_v = std::move(o.xl_to_v);
+      log = std::move(o.log);
       return *this;
     };
 
-    inline lineral sum(const var_t lhs, const var_t rhs) const noexcept { return v_to_xl_stack.top().at(lhs)+v_to_xl_stack.top().at(rhs); };
+    inline lineral sum(const vert_t lhs, const vert_t rhs) const noexcept { return v_to_xl.at(lhs)+v_to_xl.at(rhs); };
 };
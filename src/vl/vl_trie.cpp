@@ -23,13 +23,44 @@
 
 n_t curr_node, new_node_idx;
 
-void vl_trie::backtrack(trie_repr&& r, [[maybe_unused]] const var_t dl) noexcept {
-    v_node = std::move(r.v_node);
-    assigned_vert.clear();
-    for(const auto [v_idx,n_idx] : v_node) assigned_vert.insert( {n_idx,v_idx} );
-    num_vs = std::move(r.num_vs);
+void vl_trie::backtrack(trie_repr&& r, const var_t dl) noexcept {
+    assert(r.trail_size <= trail.size());
+    //undo changes in reverse order
+    while(trail.size() > r.trail_size) {
+        const auto [v,n_idx] = trail.back();
+        trail.pop_back();
+        if(n_idx == NO_NODE) {
+            //v was assigned
+            assigned_vert.erase( v_node.at(v) );
+            v_node.erase(v);
+            num_vs--;
+        } else {
+            //v was erased
+            assigned_vert[n_idx] = v;
+            v_node[v] = n_idx;
+            num_vs++;
+        }
+    }
+    //level-0 changes are never undone
+    if(dl == 0) trail.clear();
+    occ.backtrack(r.occ_size, dl);
     //prune trie
     prune(dl);
+    clear_cache();
+}
+
+void vl_trie::cache(const vert_t v, const lineral& l) const {
+    if(label_buf.size() > nodes.size()) clear_cache();
+    if(v >= span.size()) span.resize(v+1);
+    span[v] = label_span(label_buf.size(), l.get_idxs_().size(), l.has_constant());
+    label_buf.insert(label_buf.end(), l.get_idxs_().begin(), l.get_idxs_().end());
+    cached.push_back(v);
+}
+
+void vl_trie::clear_cache() const noexcept {
+    for(const auto& v : cached) uncache(v);
+    cached.clear();
+    label_buf.clear();
 }
 
 void vl_trie::prune(const var_t dl) noexcept {
@@ -45,22 +76,22 @@ void vl_trie::prune(const var_t dl) noexcept {
 }
 
 
-const trie_insert_return_type vl_trie::insert(const var_t v, const lineral& lit, const var_t dl) {
+const trie_insert_return_type vl_trie::insert(const vert_t v, const lineral& lit, const var_t dl) {
     if( v_node.contains(v) ) return trie_insert_return_type(false, false, get_vert(v_node[v]));
 
     curr_node = ROOT;
-    bool node_added = false; //as soon as one node was added, we know that we never have to check nodes[curr_node].children again!
+    bool node_added = false; //as soon as one node was added, we know that we never have to check the children of curr_node again!
     //ignores constant!
     for (auto it = lit.get_idxs_().rbegin(); it != lit.get_idxs_().rend(); ++it) {
         var_t ind = *it;
-        const auto search = node_added ? nodes[curr_node].children.end() : nodes[curr_node].children.find(ind);
-        if(search==nodes[curr_node].children.end()) {
+        const n_t search = node_added ? ROOT : get_child(curr_node, ind);
+        if(search == ROOT) {
             //add new node!
             new_node_idx = add_node(curr_node, ind, dl);
             curr_node = new_node_idx;
             node_added = true;
         } else {
-            curr_node = search->second;
+            curr_node = search;
         }
     }
 
@@ -70,13 +101,13 @@ const trie_insert_return_type vl_trie::insert(const var_t v, const lineral& lit,
             return trie_insert_return_type(false, true, get_vert(curr_node));
         } else {
             //go down one more lvl!
-            const auto search = nodes[curr_node].children.find( 0 );
-            if(search==nodes[curr_node].children.end()) {
+            const n_t search = get_child(curr_node, 0);
+            if(search == ROOT) {
                 //add new node!
                 new_node_idx = add_node(curr_node, 0, dl);
                 curr_node = new_node_idx;
             } else {
-                curr_node = search->second;
+                curr_node = search;
             }
             //curr_node is at lit!
             if(has_assigned_vert(curr_node)){
@@ -93,9 +124,9 @@ const trie_insert_return_type vl_trie::insert(const var_t v, const lineral& lit,
             return trie_insert_return_type(false, false, get_vert(curr_node));
         } else {
             //check if lit with constant exists with label!
-            const auto search = nodes[curr_node].children.find( 0 );
-            if(search!=nodes[curr_node].children.end() && has_assigned_vert(nodes[curr_node].children.at(0)) ) {
-                return trie_insert_return_type(false, true, get_vert(nodes[curr_node].children[0]) );
+            const n_t search = get_child(curr_node, 0);
+            if(search != ROOT && has_assigned_vert(search) ) {
+                return trie_insert_return_type(false, true, get_vert(search) );
             } else {
                 //assign curr_node to vert v!
                 assign_vert(curr_node, v);
@@ -105,13 +136,16 @@ const trie_insert_return_type vl_trie::insert(const var_t v, const lineral& lit,
     }
 };
 
-bool vl_trie::erase(const var_t v) {
+bool vl_trie::erase(const vert_t v) {
     assert( contains(v) );
     //note: only removes assigned vert, does not change underlying data struct!
     if(contains(v)) {
+        trail.emplace_back(v, v_node.at(v));
+        uncache(v);
         assigned_vert.erase( v_node.at(v) );
         v_node.erase(v);
         num_vs--;
+        num_erased++;
         assert(!contains(v));
         return true;
     } else {
@@ -120,7 +154,23 @@ bool vl_trie::erase(const var_t v) {
 };
 
 
-std::pair<var_t,bool> vl_trie::update(const var_t v, const lineral& l, const var_t dl) {
+n_t vl_trie::gc() {
+    assert(nodes_in_dl.size() == 1);
+    const n_t num_nodes_before = nodes.size();
+    vl_trie tr(num_vs, num_vars);
+    for(const auto& [v,n_idx] : v_node) {
+        [[maybe_unused]] const auto ins = tr.insert(v, at(v), 0);
+        assert(ins.inserted);
+    }
+    *this = std::move(tr);
+    //level-0 changes are never undone
+    trail.clear();
+    nodes.shrink_to_fit();
+    return num_nodes_before - nodes.size();
+};
+
+
+std::pair<vert_t,bool> vl_trie::update(const vert_t v, const lineral& l, const var_t dl) {
     assert(contains(v));
     [[maybe_unused]] bool erased = erase(v);
     assert(erased);
@@ -130,7 +180,7 @@ std::pair<var_t,bool> vl_trie::update(const var_t v, const lineral& l, const var
 };
 
 
-lineral vl_trie::operator[](const var_t v) const {
+lineral vl_trie::operator[](const vert_t v) const {
     vec<var_t> idxs(0);
     idxs.reserve( get_num_nodes()/num_vs + num_vars/10 );
     curr_node = v_node.at(v);
@@ -141,26 +191,33 @@ lineral vl_trie::operator[](const var_t v) const {
     return lineral(std::move(idxs), true);
 };
 
-lineral vl_trie::at(const var_t v) const {
+lineral vl_trie::at(const vert_t v) const {
     //if(v_node.at(v)==ROOT && assigned_vert.at(v_node.at(v)) != v) throw std::out_of_range("Label of vertex " + std::to_string(v) + " not found in trie.");
-    return lineral( vec<var_t>(begin(v),end()), true);
+    if(is_cached(v)) {
+        const auto& sp = span[v];
+        return lineral( vec<var_t>(label_buf.begin()+sp.off, label_buf.begin()+sp.off+sp.len), sp.p1, true );
+    }
+    lineral l( vec<var_t>(begin(v),end()), true);
+    //the cache must not be modified concurrently
+    if(!omp_in_parallel()) cache(v, l);
+    return l;
 };
 
-var_t vl_trie::operator[](const lineral& lit) const {
+vert_t vl_trie::operator[](const lineral& lit) const {
     curr_node = ROOT;
     for (auto it = lit.get_idxs_().rbegin(); it != lit.get_idxs_().rend(); ++it) {
         var_t ind = *it;
-        const auto search = nodes[curr_node].children.find( ind );
-        if(search != nodes[curr_node].children.end()) {
-            curr_node = search->second;
+        const n_t search = get_child(curr_node, ind);
+        if(search != ROOT) {
+            curr_node = search;
         } else {
             return 0;
         };
     }
     if(lit.has_constant()) {
-        const auto search = nodes[curr_node].children.find( 0 );
-        if(search != nodes[curr_node].children.end()) {
-            curr_node = search->second;
+        const n_t search = get_child(curr_node, 0);
+        if(search != ROOT) {
+            curr_node = search;
         } else {
             return 0;
         }
@@ -169,21 +226,21 @@ var_t vl_trie::operator[](const lineral& lit) const {
     return has_assigned_vert(curr_node) ? assigned_vert.at(curr_node) : 0;
 };
 
-var_t vl_trie::at(const lineral& lit) const {
+vert_t vl_trie::at(const lineral& lit) const {
     curr_node = ROOT;
     for (auto it = lit.get_idxs_().rbegin(); it != lit.get_idxs_().rend(); ++it) {
         var_t ind = *it;
-        const auto search = nodes[curr_node].children.find( ind );
-        if(search != nodes[curr_node].children.end()) {
-            curr_node = search->second;
+        const n_t search = get_child(curr_node, ind);
+        if(search != ROOT) {
+            curr_node = search;
         } else {
             throw std::out_of_range("Vertex of label " + lit.to_str() + " not found in trie.");
         };
     }
     if(lit.has_constant()) {
-        const auto search = nodes[curr_node].children.find( 0 );
-        if(search != nodes[curr_node].children.end()) {
-            curr_node = search->second;
+        const n_t search = get_child(curr_node, 0);
+        if(search != ROOT) {
+            curr_node = search;
         } else {
             throw std::out_of_range("Vertex of label " + lit.to_str() + " not found in trie.");
         }
@@ -194,15 +251,15 @@ var_t vl_trie::at(const lineral& lit) const {
     return search->second;
 };
 
-std::pair<var_t,bool> vl_trie::at_(const lineral& lit) const {
+std::pair<vert_t,bool> vl_trie::at_(const lineral& lit) const {
     //iter down the trie!
     curr_node = ROOT;
     for (auto it = lit.get_idxs_().rbegin(); it != lit.get_idxs_().rend(); ++it) {
         var_t ind = *it;
-        const auto search = nodes[curr_node].children.find( ind );
+        const n_t search = get_child(curr_node, ind);
         //go down one more lvl -- if possible!
-        if(search != nodes[curr_node].children.end()) {
-            curr_node = search->second;
+        if(search != ROOT) {
+            curr_node = search;
         } else {
             throw std::out_of_range("Vertex of label " + lit.to_str() + " not found in trie.");
         };
@@ -216,9 +273,9 @@ std::pair<var_t,bool> vl_trie::at_(const lineral& lit) const {
     } else {
         //lit without constant is not contained, check if lit with constant is there!
         //go down on more step!
-        const auto search_ = nodes[curr_node].children.find( 0 );
-        if(search_ != nodes[curr_node].children.end()) {
-            curr_node = search_->second;
+        const n_t search_ = get_child(curr_node, 0);
+        if(search_ != ROOT) {
+            curr_node = search_;
         } else {
             throw std::out_of_range("Vertex of label " + lit.to_str() + " not found in trie.");
         };
@@ -235,17 +292,17 @@ bool vl_trie::contains(const lineral& lit) const {
     curr_node = ROOT;
     for (auto it = lit.get_idxs_().rbegin(); it != lit.get_idxs_().rend(); ++it) {
         var_t ind = *it;
-        const auto search = nodes[curr_node].children.find( ind );
-        if(search != nodes[curr_node].children.end()) {
-            curr_node = search->second;
+        const n_t search = get_child(curr_node, ind);
+        if(search != ROOT) {
+            curr_node = search;
         } else {
             return 0;
         };
     }
     if(lit.has_constant()) {
-        const auto search = nodes[curr_node].children.find( 0 );
-        if(search != nodes[curr_node].children.end()) {
-            curr_node = search->second;
+        const n_t search = get_child(curr_node, 0);
+        if(search != ROOT) {
+            curr_node = search;
         } else {
             return 0;
         }
@@ -262,9 +319,16 @@ std::string vl_trie::to_str() const {
     return str;
 };
     
-vec<var_t> diff(0);
-lineral vl_trie::sum(const var_t lhs, const var_t rhs) const {
+thread_local vec<var_t> diff(0); //thread_local, as sums are computed in parallel in scc_analysis
+lineral vl_trie::sum(const vert_t lhs, const vert_t rhs) const {
   diff.clear();
+  if(is_cached(lhs) && is_cached(rhs)) {
+    const auto& sp_l = span[lhs];
+    const auto& sp_r = span[rhs];
+    diff.reserve( sp_l.len + sp_r.len );
+    std::set_symmetric_difference(label_buf.begin()+sp_l.off, label_buf.begin()+sp_l.off+sp_l.len, label_buf.begin()+sp_r.off, label_buf.begin()+sp_r.off+sp_r.len, std::back_inserter(diff));
+    return lineral(std::move(diff), sp_l.p1 ^ sp_r.p1, true);
+  }
   diff.reserve( get_num_nodes()/num_vs + num_vars/10 );
   std::set_symmetric_difference(begin(lhs), end(), begin(rhs), end(), std::back_inserter(diff));
   //NOTE back_insterter might lead to repeated reallocations!
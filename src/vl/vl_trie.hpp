@@ -25,10 +25,12 @@
 #include <list>
 #include <map>
 #include <iterator>
+#include <algorithm>
 
 #include "../misc.hpp"
 #include "../LA/lineral.hpp"
 #include "../LA/lineqs.hpp"
+#include "occ_index.hpp"
 
 #include "../robin_hood-3.11.5/robin_hood.h"
 //#include "../parallel-hashmap/phmap.h"
@@ -53,27 +55,205 @@
  */
 typedef unsigned int n_t;
 
+/**
+ * @brief node_idx indicating that there is no node
+ */
+#define NO_NODE ((n_t) -1)
+
 struct trie_insert_return_type {
     const bool inserted;
     const bool found_plus_one;
-    const var_t vert;
+    const vert_t vert;
 
-    trie_insert_return_type(const bool& _inserted, const bool& _found_plus_one, const var_t _vert) : inserted(_inserted), found_plus_one(_found_plus_one), vert(_vert) {};
+    trie_insert_return_type(const bool& _inserted, const bool& _found_plus_one, const vert_t _vert) : inserted(_inserted), found_plus_one(_found_plus_one), vert(_vert) {};
     ~trie_insert_return_type() {};
 };
 
+/**
+ * @brief len of label_span of labels that are not cached
+ */
+#define NO_SPAN ((var_t) -1)
+
+/**
+ * @brief position of a cached label in the label buffer of vl_trie
+ */
+struct label_span {
+  /**
+   * @brief offset of the first index of the label in the buffer
+   */
+  size_t off = 0;
+
+  /**
+   * @brief number of indices of the label (without constant); NO_SPAN if the label is not cached
+   */
+  var_t len = NO_SPAN;
+
+  /**
+   * @brief constant of the label
+   */
+  bool p1 = false;
+
+  label_span() noexcept {};
+  label_span(const size_t _off, const var_t _len, const bool _p1) noexcept : off(_off), len(_len), p1(_p1) {};
+};
+
 struct trie_repr {
-  const child_map<var_t,n_t> v_node;
-  const n_t num_vs = 0;
+  /**
+   * @brief size of the trail when the state was saved
+   */
+  const size_t trail_size = 0;
+
+  /**
+   * @brief state of the occurrence index when the state was saved
+   */
+  const size_t occ_size = 0;
 
   trie_repr() noexcept {};
-  trie_repr(const trie_repr& o) noexcept : v_node(o.v_node), num_vs(o.num_vs) {};
-  trie_repr(trie_repr&& o) noexcept : v_node(std::move(o.v_node)), num_vs(std::move(o.num_vs)) {};
-  trie_repr(const child_map<var_t,n_t>& _v_node, const n_t _num_vs) noexcept : v_node(_v_node), num_vs(_num_vs) {};
+  trie_repr(const trie_repr& o) noexcept : trail_size(o.trail_size), occ_size(o.occ_size) {};
+  trie_repr(trie_repr&& o) noexcept : trail_size(o.trail_size), occ_size(o.occ_size) {};
+  trie_repr(const size_t _trail_size, const size_t _occ_size) noexcept : trail_size(_trail_size), occ_size(_occ_size) {};
   ~trie_repr() {};
 };
 
 
+/**
+ * @brief children of a trie node as array of (label, node_idx) pairs sorted by label; a single child is stored inline, only more children are stored in a heap-allocated array
+ * @note most nodes have at most one child, hence this avoids a heap-allocated hash table per node
+ */
+class child_arr {
+  public:
+    typedef std::pair<var_t,n_t> entry;
+
+  private:
+    /**
+     * @brief number of children
+     */
+    n_t sz = 0;
+
+    /**
+     * @brief capacity of arr; 0 iff the (at most one) child is stored in one
+     */
+    n_t cap = 0;
+
+    union {
+      entry one;
+      entry* arr;
+    };
+
+    inline entry* data() noexcept { return cap ? arr : &one; };
+
+    inline entry* lower_bound(const var_t label) noexcept {
+      return std::lower_bound(data(), data()+sz, label, [](const entry& e, const var_t l) { return e.first < l; });
+    };
+
+    //releases the heap-allocated array, if the children fit inline
+    inline void shrink() noexcept {
+      if(cap == 0 || sz > 1) return;
+      const entry e = sz ? arr[0] : entry(0, ROOT);
+      delete[] arr;
+      cap = 0;
+      one = e;
+    };
+
+  public:
+    child_arr() noexcept : one(0, ROOT) {};
+    child_arr(const child_arr& o) noexcept : sz(o.sz), cap(o.sz > 1 ? o.sz : 0), one(0, ROOT) {
+      if(cap) {
+        arr = new entry[cap];
+        std::copy(o.begin(), o.end(), arr);
+      } else if(sz) {
+        one = *o.begin();
+      }
+    };
+    child_arr(child_arr&& o) noexcept : sz(o.sz), cap(o.cap), one(0, ROOT) {
+      if(cap) arr = o.arr;
+      else one = o.one;
+      o.sz = 0;
+      o.cap = 0;
+    };
+    ~child_arr() { if(cap) delete[] arr; };
+
+    child_arr& operator =(const child_arr& o) noexcept { child_arr cpy(o); return *this = std::move(cpy); };
+    child_arr& operator =(child_arr&& o) noexcept {
+      if(this == &o) return *this;
+      if(cap) delete[] arr;
+      sz = o.sz;
+      cap = o.cap;
+      if(cap) arr = o.arr;
+      else one = o.one;
+      o.sz = 0;
+      o.cap = 0;
+      return *this;
+    };
+
+    inline const entry* begin() const noexcept { return cap ? arr : &one; };
+    inline const entry* end() const noexcept { return begin()+sz; };
+    inline n_t size() const noexcept { return sz; };
+
+    /**
+     * @brief finds child with given label
+     * 
+     * @param label label of child
+     * @return const entry* pointer to (label, node_idx) of child; end() if there is none
+     */
+    inline const entry* find(const var_t label) const noexcept {
+      const entry* it = std::lower_bound(begin(), end(), label, [](const entry& e, const var_t l) { return e.first < l; });
+      return (it != end() && it->first == label) ? it : end();
+    };
+
+    inline bool contains(const var_t label) const noexcept { return find(label) != end(); };
+
+    inline n_t at(const var_t label) const noexcept { assert(contains(label)); return find(label)->second; };
+
+    /**
+     * @brief adds child with given label, if there is none yet
+     * 
+     * @param label label of child
+     * @param node_idx node_idx of child
+     * @return true iff child was added
+     */
+    bool emplace(const var_t label, const n_t node_idx) noexcept {
+      entry* it = lower_bound(label);
+      if(it != data()+sz && it->first == label) return false;
+      const n_t pos = it - data();
+      if(sz == 0 && cap == 0) {
+        one = entry(label, node_idx);
+        ++sz;
+        return true;
+      }
+      if(sz >= cap) {
+        //grow heap array (and move inline child into it)
+        const n_t new_cap = std::max<n_t>(2, 2*cap);
+        entry* new_arr = new entry[new_cap];
+        std::copy(begin(), end(), new_arr);
+        if(cap) delete[] arr;
+        arr = new_arr;
+        cap = new_cap;
+      }
+      std::copy_backward(arr+pos, arr+sz, arr+sz+1);
+      arr[pos] = entry(label, node_idx);
+      ++sz;
+      return true;
+    };
+
+    /**
+     * @brief removes child with given label, if there is one
+     * 
+     * @param label label of child
+     * @return true iff child was removed
+     */
+    bool erase(const var_t label) noexcept {
+      entry* it = lower_bound(label);
+      if(it == data()+sz || it->first != label) return false;
+      std::copy(it+1, data()+sz, it);
+      --sz;
+      shrink();
+      return true;
+    };
+
+    inline void clear() noexcept { sz = 0; shrink(); };
+};
+
 struct node {
   /**
    * @brief node_idx of parent
@@ -88,7 +268,7 @@ struct node {
   /**
    * @brief children of node; maps label onto childrens' node_idx
    */
-  child_map<var_t,n_t> children; 
+  child_arr children;
 
   node(const n_t _parent, const var_t _label) noexcept : parent(_parent), label(_label) {};
   node(const node& o) noexcept : parent(o.parent), label(o.label), children(o.children) {};
@@ -106,15 +286,21 @@ class vl_trie
      */
     vec< node > nodes; //TODO change to stack and change nodes to have pointers to parents and children?
 
+    /**
+     * @brief root_children[label] is node_idx of the child of ROOT with label label, ROOT if there is none
+     * @note the root has a child for (almost) every LT of the labels, hence its children are indexed directly
+     */
+    vec< n_t > root_children;
+
     /**
      * @brief v_node[v] is node_idx for vertex v
      */
-    child_map<var_t,n_t> v_node;
+    child_map<vert_t,n_t> v_node;
 
     /**
      * @brief map assigning node_idx their vertex - if they have one!
      */
-    child_map<n_t,var_t> assigned_vert;
+    child_map<n_t,vert_t> assigned_vert;
 
     /**
      * @brief number of variables of the linerals
@@ -137,6 +323,55 @@ class vl_trie
      */
     std::stack< std::list<n_t> > nodes_in_dl;
 
+    /**
+     * @brief number of labels erased since the last call of gc; their nodes may no longer lie on the path of any label
+     */
+    n_t num_erased = 0;
+
+    /**
+     * @brief trail of changes of v_node, i.e., pairs (v,n) where n is the node_idx of v before the change, NO_NODE if v had none
+     * @note undone in reverse order by backtrack
+     */
+    vec< std::pair<vert_t,n_t> > trail;
+
+    /**
+     * @brief label cache: span[v] is the position of the label of v in label_buf, len NO_SPAN if it is not cached
+     * @note filled by at(v) outside of parallel regions, invalidated by erase and assign_vert, and cleared on backtrack or if label_buf outgrows the trie
+     */
+    mutable vec< label_span > span;
+
+    /**
+     * @brief indices of cached labels, stored contiguously
+     */
+    mutable vec< var_t > label_buf;
+
+    /**
+     * @brief vertices with cached labels, i.e., with valid span
+     */
+    mutable vec< vert_t > cached;
+
+    /**
+     * @brief occurrence index of the labels
+     */
+    occ_index occ;
+
+    inline bool is_cached(const vert_t v) const noexcept { return v < span.size() && span[v].len != NO_SPAN; };
+
+    inline void uncache(const vert_t v) const noexcept { if(v < span.size()) span[v].len = NO_SPAN; };
+
+    /**
+     * @brief caches label l of vertex v; clears the cache first if label_buf holds more indices than the trie has nodes
+     * 
+     * @param v vertex
+     * @param l label of v
+     */
+    void cache(const vert_t v, const lineral& l) const;
+
+    /**
+     * @brief invalidates all cached labels
+     */
+    void clear_cache() const noexcept;
+
     void register_node(const n_t node_idx, const var_t dl) {
       while(dl >= nodes_in_dl.size()) nodes_in_dl.emplace( std::list<n_t>() );
       nodes_in_dl.top().push_back(node_idx);
@@ -167,8 +402,14 @@ class vl_trie
         nodes[node_idx].children.clear();
         register_node( node_idx, dl );
       }
-      [[maybe_unused]] const auto insert = nodes[parent_idx].children.emplace( label, node_idx );
-      assert(insert.second);
+      if(parent_idx == ROOT) {
+        if(label >= root_children.size()) root_children.resize(label+1, ROOT);
+        assert(root_children[label] == ROOT);
+        root_children[label] = node_idx;
+      } else {
+        [[maybe_unused]] const bool inserted = nodes[parent_idx].children.emplace( label, node_idx );
+        assert(inserted);
+      }
       return node_idx;
     }
     
@@ -180,7 +421,8 @@ class vl_trie
      */
     inline void remove_node(const n_t node_idx) noexcept {
       //rm link from parent
-      nodes[nodes[node_idx].parent].children.erase( nodes[node_idx].label );
+      if(nodes[node_idx].parent == ROOT) root_children[nodes[node_idx].label] = ROOT;
+      else nodes[nodes[node_idx].parent].children.erase( nodes[node_idx].label );
       //rm link to all children! //should be done before using this node again!
       //nodes[node_idx].children.clear();
       //re-init parent and node_label! 
@@ -188,9 +430,29 @@ class vl_trie
       unused_node_idxs.push( node_idx );
     }
 
-    inline void assign_vert(const n_t n, const var_t v) { assigned_vert[n] = v; v_node[v] = n; num_vs++; };
+    inline void assign_vert(const n_t n, const vert_t v) {
+      assigned_vert[n] = v;
+      v_node[v] = n;
+      num_vs++;
+      trail.emplace_back(v, NO_NODE);
+      uncache(v);
+      for(n_t n_ = n; n_ != ROOT; n_ = nodes[n_].parent) occ.add(v, nodes[n_].label);
+    };
 
     inline bool has_assigned_vert(const n_t n) const { return assigned_vert.contains(n); };
+
+    /**
+     * @brief child of a node with given label
+     * 
+     * @param n node_idx
+     * @param label label of child
+     * @return n_t node_idx of child; ROOT if there is none
+     */
+    inline n_t get_child(const n_t n, const var_t label) const noexcept {
+      if(n == ROOT) return label < root_children.size() ? root_children[label] : ROOT;
+      const auto search = nodes[n].children.find(label);
+      return search != nodes[n].children.end() ? search->second : ROOT;
+    };
     
     /**
      * @brief prunes trie to given decision-level dl, i.e., removes all nodes added later than dl
@@ -199,12 +461,12 @@ class vl_trie
      */
     void prune(const var_t dl) noexcept;
 
-    inline var_t get_vert(const n_t n) const noexcept { return assigned_vert.at(n); };
+    inline vert_t get_vert(const n_t n) const noexcept { return assigned_vert.at(n); };
 
   public:
     vl_trie() noexcept : vl_trie(1) {};
 
-    vl_trie(const var_t _num_vars) noexcept : num_vars(_num_vars) {
+    vl_trie(const var_t _num_vars) noexcept : root_children((size_t) _num_vars+1, ROOT), num_vars(_num_vars) {
       unused_node_idxs = std::stack<n_t>();
       nodes_in_dl = std::stack< std::list<n_t> >();
       //add root, i.e., add new els to children, parents
@@ -212,21 +474,51 @@ class vl_trie
       register_node(ROOT, 0);
     };
 
-    vl_trie([[maybe_unused]] const var_t num_verts, const var_t _num_vars) noexcept : vl_trie(_num_vars)  { nodes.reserve(num_verts); };
+    vl_trie([[maybe_unused]] const vert_t num_verts, const var_t _num_vars) noexcept : vl_trie(_num_vars)  { nodes.reserve(num_verts); };
 
-    vl_trie(const vl_trie& tr) noexcept : nodes(tr.nodes), v_node(tr.v_node), assigned_vert(tr.assigned_vert), num_vars(tr.num_vars), num_vs(tr.num_vs), unused_node_idxs(tr.unused_node_idxs) {};
+    vl_trie(const vl_trie& tr) noexcept : nodes(tr.nodes), root_children(tr.root_children), v_node(tr.v_node), assigned_vert(tr.assigned_vert), num_vars(tr.num_vars), num_vs(tr.num_vs), unused_node_idxs(tr.unused_node_idxs), nodes_in_dl(tr.nodes_in_dl), num_erased(tr.num_erased), trail(tr.trail), span(tr.span), label_buf(tr.label_buf), cached(tr.cached), occ(tr.occ) {};
     
-    vl_trie(vl_trie&& tr) noexcept : nodes(std::move(tr.nodes)), v_node(std::move(tr.v_node)), assigned_vert(std::move(tr.assigned_vert)), num_vars(std::move(tr.num_vars)), num_vs(std::move(tr.num_vs)), unused_node_idxs(std::move(tr.unused_node_idxs)) {};
+    vl_trie(vl_trie&& tr) noexcept : nodes(std::move(tr.nodes)), root_children(std::move(tr.root_children)), v_node(std::move(tr.v_node)), assigned_vert(std::move(tr.assigned_vert)), num_vars(std::move(tr.num_vars)), num_vs(std::move(tr.num_vs)), unused_node_idxs(std::move(tr.unused_node_idxs)), nodes_in_dl(std::move(tr.nodes_in_dl)), num_erased(tr.num_erased), trail(std::move(tr.trail)), span(std::move(tr.span)), label_buf(std::move(tr.label_buf)), cached(std::move(tr.cached)), occ(std::move(tr.occ)) {};
 
     ~vl_trie() {};
 
-    trie_repr get_state() const { return trie_repr(v_node, num_vs); };
+    trie_repr get_state() const { return trie_repr(trail.size(), occ.get_state()); };
 
+    /**
+     * @brief restores the vertex labels of a saved state by undoing the changes on the trail since then, and prunes the trie to the given decision level
+     * 
+     * @param r saved state
+     * @param dl decision level to prune to; the trail is cleared if it is 0, as level-0 changes are never undone
+     * @note complexity is linear in the number of changes since r was saved (plus the number of pruned nodes)
+     */
     void backtrack(trie_repr&& r, const var_t dl) noexcept;
 
-    inline var_t size() const noexcept { return num_vs; };
+    inline vert_t size() const noexcept { return num_vs; };
+
+    inline n_t get_num_nodes() const noexcept { return nodes.size()-unused_node_idxs.size(); };
+
+    /**
+     * @brief rebuilds the trie from the labels of the stored vertices only, i.e., drops all nodes that are not on the path of a label and releases their memory
+     * @note must only be called at decision level 0, as all nodes are afterwards considered to be added in decision level 0
+     * 
+     * @return n_t number of freed nodes
+     */
+    n_t gc();
+
+    /**
+     * @brief checks whether gc is worth its cost, i.e., whether more labels were erased (or updated) since the last gc than there are labels
+     * 
+     * @return true iff gc should be called
+     */
+    inline bool gc_due() const noexcept { return num_erased > num_vs; };
 
-    inline var_t get_num_nodes() const noexcept { return nodes.size()-unused_node_idxs.size(); };
+    /**
+     * @brief vertices whose label contains x; may also contain vertices whose label no longer contains x or that have no label at all
+     * 
+     * @param x variable
+     * @return const vec<vert_t>& list of vertices
+     */
+    inline const vec<vert_t>& get_occ(const var_t x) const noexcept { return occ[x]; };
 
     /**
      * @brief inserts lit if not yet present
@@ -236,7 +528,7 @@ class vl_trie
      * @param dl current decision level - defaults to 0
      * @return trie_insert_return_type field inserted is true iff lit could be assigned to v; field node_idx points to the node representing lit, to get corr vert use get_vert
      */
-    const trie_insert_return_type insert(const var_t v, const lineral& lit, const var_t dl);
+    const trie_insert_return_type insert(const vert_t v, const lineral& lit, const var_t dl);
 
     /**
      * @brief erase vertex v from trie (along with its label)
@@ -244,7 +536,7 @@ class vl_trie
      * @param v vertex to be removed
      * @return true iff vert could be erased
      */
-    bool erase(const var_t v);
+    bool erase(const vert_t v);
 
     /**
      * @brief updates lit assigned to v to l
@@ -252,9 +544,9 @@ class vl_trie
      * @param v vertex to update
      * @param l label to change to
      * @param dl current decision level - if not provided defaults to 0
-     * @return var_t vert where lit is stored (or lit+1); bool true iff vert points to lit+1
+     * @return vert_t vert where lit is stored (or lit+1); bool true iff vert points to lit+1
      */
-    std::pair<var_t,bool> update(const var_t v, const lineral& l, const var_t dl);
+    std::pair<vert_t,bool> update(const vert_t v, const lineral& l, const var_t dl);
 
     /**
      * @brief retrieves lineral of vertex
@@ -263,43 +555,43 @@ class vl_trie
      * @note complexity is linear in size of literal to be found (if there is none, constant)
      * @return lineral literal of vertex v
      */
-    lineral operator[](const var_t v) const;
+    lineral operator[](const vert_t v) const;
     
     /**
-     * @brief retrieves lineral of vertex
+     * @brief retrieves lineral of vertex; copied from the label cache if possible, otherwise the label is cached (outside of parallel regions)
      * 
      * @param v vertex to search literal of
      * @note complexity is linear in size of literal to be found (if there is none, constant)
      * @return lineral literal of vertex v
      */
-    lineral at(const var_t v) const;
+    lineral at(const vert_t v) const;
 
     /**
      * @brief retrieves vertex of lit
      * 
      * @param lit literal to search vertex of
      * @note complexity is amortized linear in lit.get_idxs().size()
-     * @return var_t vertex of lit; 0 if there is none!
+     * @return vert_t vertex of lit; 0 if there is none!
      */
-    var_t operator[](const lineral& lit) const;
+    vert_t operator[](const lineral& lit) const;
 
     /**
      * @brief retrieves vertex of lit
      * 
      * @param lit literal to search vertex of
      * @note complexity is amortized linear in lit.get_idxs().size()
-     * @return var_t vertex of lit;
+     * @return vert_t vertex of lit;
      */
-    var_t at(const lineral& lit) const;
+    vert_t at(const lineral& lit) const;
     
     /**
      * @brief retrieves vertex of lit -- checks
      * 
      * @param lit literal to search vertex of
      * @note complexity is amortized linear in lit.get_idxs().size()
-     * @return var_t vertex of lit (or lit+1); bool true iff lit was found
+     * @return vert_t vertex of lit (or lit+1); bool true iff lit was found
      */
-    std::pair<var_t,bool> at_(const lineral& lit) const;
+    std::pair<vert_t,bool> at_(const lineral& lit) const;
 
     /**
      * @brief compute string repr of object, listing all stored pairs (v, lit) in sorted order.
@@ -317,7 +609,7 @@ class vl_trie
     bool contains(const lineral& lit) const;
 
     
-    inline var_t V(const lineral &l) const {
+    inline vert_t V(const lineral &l) const {
       const auto [v,b] = at_(l);
       //b is true if l was found at v; otherwise l+1 was found at v.
       return b ? v : SIGMA(v); 
@@ -328,11 +620,11 @@ class vl_trie
       return contains(l) || contains(l.plus_one());
     }
 
-    inline bool Vxlit_contains(const var_t &v) const {
+    inline bool Vxlit_contains(const vert_t &v) const {
       return contains(v);
     }
 
-    inline lineral Vxlit(const var_t &v) const {
+    inline lineral Vxlit(const vert_t &v) const {
       assert( contains(v) || contains(SIGMA(v)) );
       if(contains(v)) {
         return at(v);
@@ -343,7 +635,7 @@ class vl_trie
       }
     }
 
-    inline var_t Vxlit_LT(const var_t &v) const {
+    inline var_t Vxlit_LT(const vert_t &v) const {
       auto it = begin( contains(v) ? v : SIGMA(v) );
       return *it!=0 ? *it : *(++it);
     }
@@ -352,14 +644,14 @@ class vl_trie
     /**
      * @brief returns a tuple allowing to find the vertex representing zero - if it exists
      * 
-     * @return std::tuple<bool,bool,var_t> 1st bool true if zero exists; 2nd bool true iff 1 was found; 3rd var_t vertex found
+     * @return std::tuple<bool,bool,vert_t> 1st bool true if zero exists; 2nd bool true iff 1 was found; 3rd vert_t vertex found
      */
-    std::tuple<bool,bool,var_t> if_exists_get_zero_v() const {
+    std::tuple<bool,bool,vert_t> if_exists_get_zero_v() const {
       if(has_assigned_vert(ROOT)) {
         return {true, false, get_vert(ROOT)};
-      } else if(nodes[ROOT].children.contains(0) && has_assigned_vert(nodes[ROOT].children.at(0))) {
+      } else if(get_child(ROOT, 0) != ROOT && has_assigned_vert(get_child(ROOT, 0))) {
         //there is one!
-        return {true, true, get_vert( nodes[ROOT].children.at(0) )};
+        return {true, true, get_vert( get_child(ROOT, 0) )};
       } else {
         //we have neither 0 nor 1...
         return {false, false, -1};
@@ -372,29 +664,47 @@ class vl_trie
      * @param v vert to check containment
      * @return true iff vert has literal in trie
      */
-    inline bool contains(const var_t v) const { return v_node.contains(v); };
+    inline bool contains(const vert_t v) const { return v_node.contains(v); };
 
     vl_trie& operator =(const vl_trie& o) noexcept {
-      v_node = child_map<var_t,n_t>(o.v_node);
+      v_node = child_map<vert_t,n_t>(o.v_node);
       nodes = vec< node >(o.nodes);
-      assigned_vert = child_map<n_t,var_t>(o.assigned_vert);
+      root_children = o.root_children;
+      assigned_vert = child_map<n_t,vert_t>(o.assigned_vert);
       num_vars = o.num_vars;
       num_vs = o.num_vs;
+      unused_node_idxs = o.unused_node_idxs;
+      nodes_in_dl = o.nodes_in_dl;
+      num_erased = o.num_erased;
+      trail = o.trail;
+      span = o.span;
+      label_buf = o.label_buf;
+      cached = o.cached;
+      occ = o.occ;
       return *this;
     };
 
-    vl_trie& operator =(const vl_trie&& o) noexcept {
-      v_node = child_map<var_t,n_t>(std::move(o.v_node));
-      nodes = vec< node >(std::move(o.nodes));
-      assigned_vert = child_map<n_t,var_t>(std::move(o.assigned_vert));
-      num_vars = std::move(o.num_vars);
-      num_vs = std::move(o.num_vs);
+    vl_trie& operator =(vl_trie&& o) noexcept {
+      v_node = std::move(o.v_node);
+      nodes = std::move(o.nodes);
+      root_children = std::move(o.root_children);
+      assigned_vert = std::move(o.assigned_vert);
+      num_vars = o.num_vars;
+      num_vs = o.num_vs;
+      unused_node_idxs = std::move(o.unused_node_idxs);
+      nodes_in_dl = std::move(o.nodes_in_dl);
+      num_erased = o.num_erased;
+      trail = std::move(o.trail);
+      span = std::move(o.span);
+      label_buf = std::move(o.label_buf);
+      cached = std::move(o.cached);
+      occ = std::move(o.occ);
       return *this;
     };
 
 
     /**
-     * @brief const forward iterator, can be used instead of operator[](var_t) to avoid unnecessary copy and creation of lineral (!)
+     * @brief const forward iterator, can be used instead of operator[](vert_t) to avoid unnecessary copy and creation of lineral (!)
      */
     class const_iterator {
       private:
@@ -432,7 +742,7 @@ class vl_trie
      * @param v vertex
      * @return const_iterator starting at node repr vertex v
      */
-    const_iterator begin(const var_t v) const { return const_iterator(this, v_node.at(v)); }
+    const_iterator begin(const vert_t v) const { return const_iterator(this, v_node.at(v)); }
 
     /**
      * @brief const_iterator repr root, i.e., end of every path
@@ -441,5 +751,5 @@ class vl_trie
      */
     const_iterator end() const { return const_iterator(this, ROOT); }
 
-    lineral sum(const var_t lhs, const var_t rhs) const;
+    lineral sum(const vert_t lhs, const vert_t rhs) const;
 };
@@ -20,9 +20,14 @@
 
 #include "../src/solve.hpp"
 #include "../src/impl_graph.hpp"
+#include "../src/vl/vl_trie.hpp"
+#include "../src/vl/vl_hcons.hpp"
 
 #include <benchmark/benchmark.h>
 
+#include <random>
+#include <set>
+
 #define concat(first, second) first second
 
 
@@ -43,6 +48,104 @@ BENCHMARK_CAPTURE(BM_dpll_solve, mq-toyexample-type1-n15,  concat(BENCH_FILES, "
 BENCHMARK_CAPTURE(BM_dpll_solve, mq-toyexample-type1-n15,  concat(BENCH_FILES, "/ToyExample-type1-n15-seed3.xnf") )->Unit(benchmark::kMillisecond)->MinTime(2);
 BENCHMARK_CAPTURE(BM_dpll_solve, mq-toyexample-type1-n15,  concat(BENCH_FILES, "/ToyExample-type1-n15-seed4.xnf") )->Unit(benchmark::kMillisecond)->MinTime(2);
 
+//distinct random sparse linerals in n vars of size at most k; every second one shares all but its smallest ind with a previous one
+static vec<lineral> random_linerals(const var_t n, const var_t k, const size_t count) {
+    std::mt19937 gen(42);
+    vec<lineral> lits;
+    std::set<std::string> seen;
+    lits.reserve(count);
+    vec<var_t> idxs;
+    while(lits.size() < count) {
+        if(lits.size() % 2 == 1) {
+            idxs = vec<var_t>(lits[gen() % lits.size()].get_idxs_());
+            if(!idxs.empty()) idxs.erase(idxs.begin());
+            idxs.push_back( gen() % n + 1 );
+        } else {
+            idxs.clear();
+            const var_t sz = gen() % k + 1;
+            for(var_t i = 0; i < sz; ++i) idxs.push_back( gen() % n + 1 );
+        }
+        lineral l(idxs);
+        if(!l.is_zero() && seen.insert(l.to_str()).second) lits.emplace_back( std::move(l) );
+    }
+    return lits;
+}
+
+static void BM_trie_insert(benchmark::State& state) {
+    const auto lits = random_linerals(state.range(0), 8, state.range(1));
+    for (auto _ : state) {
+        vl_trie tr(2*lits.size(), state.range(0));
+        for(vert_t v = 0; v < lits.size(); ++v) benchmark::DoNotOptimize( tr.insert(2*v, lits[v], 0) );
+    }
+    state.SetItemsProcessed(state.iterations() * lits.size());
+}
+
+static void BM_trie_at_(benchmark::State& state) {
+    const auto lits = random_linerals(state.range(0), 8, state.range(1));
+    vl_trie tr(2*lits.size(), state.range(0));
+    for(vert_t v = 0; v < lits.size(); ++v) tr.insert(2*v, lits[v], 0);
+    for (auto _ : state) {
+        for(const auto& l : lits) benchmark::DoNotOptimize( tr.at_(l) );
+    }
+    state.SetItemsProcessed(state.iterations() * lits.size());
+}
+
+static void BM_trie_update(benchmark::State& state) {
+    const auto lits = random_linerals(state.range(0), 8, 2*state.range(1));
+    const vert_t m = lits.size()/2;
+    vl_trie tr(lits.size(), state.range(0));
+    for(vert_t v = 0; v < m; ++v) tr.insert(2*v, lits[v], 0);
+    bool fwd = true;
+    for (auto _ : state) {
+        //move each label to a fresh lineral and back
+        for(vert_t v = 0; v < m; ++v) benchmark::DoNotOptimize( tr.update(2*v, lits[fwd ? m+v : v], 0) );
+        fwd = !fwd;
+    }
+    state.SetItemsProcessed(state.iterations() * m);
+}
+
+BENCHMARK(BM_trie_insert)->Args({1000, 1<<14})->Args({20000, 1<<16})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_trie_at_)->Args({1000, 1<<14})->Args({20000, 1<<16})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_trie_update)->Args({1000, 1<<14})->Args({20000, 1<<16})->Unit(benchmark::kMillisecond);
+
+static void BM_hcons_insert(benchmark::State& state) {
+    const auto lits = random_linerals(state.range(0), 8, state.range(1));
+    for (auto _ : state) {
+        vl_hcons vl(2*lits.size(), state.range(0));
+        for(vert_t v = 0; v < lits.size(); ++v) benchmark::DoNotOptimize( vl.insert(2*v, lits[v], 0) );
+    }
+    state.SetItemsProcessed(state.iterations() * lits.size());
+}
+
+static void BM_hcons_at_(benchmark::State& state) {
+    const auto lits = random_linerals(state.range(0), 8, state.range(1));
+    vl_hcons vl(2*lits.size(), state.range(0));
+    for(vert_t v = 0; v < lits.size(); ++v) vl.insert(2*v, lits[v], 0);
+    for (auto _ : state) {
+        for(const auto& l : lits) benchmark::DoNotOptimize( vl.at_(l) );
+    }
+    state.SetItemsProcessed(state.iterations() * lits.size());
+}
+
+static void BM_hcons_update(benchmark::State& state) {
+    const auto lits = random_linerals(state.range(0), 8, 2*state.range(1));
+    const vert_t m = lits.size()/2;
+    vl_hcons vl(lits.size(), state.range(0));
+    for(vert_t v = 0; v < m; ++v) vl.insert(2*v, lits[v], 0);
+    bool fwd = true;
+    for (auto _ : state) {
+        //move each label to a fresh lineral and back
+        for(vert_t v = 0; v < m; ++v) benchmark::DoNotOptimize( vl.update(2*v, lits[fwd ? m+v : v], 0) );
+        fwd = !fwd;
+    }
+    state.SetItemsProcessed(state.iterations() * m);
+}
+
+BENCHMARK(BM_hcons_insert)->Args({1000, 1<<14})->Args({20000, 1<<16})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_hcons_at_)->Args({1000, 1<<14})->Args({20000, 1<<16})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_hcons_update)->Args({1000, 1<<14})->Args({20000, 1<<16})->Unit(benchmark::kMillisecond);
+
+
 int xlit_performance(var_t n, long k) {
     //compute k random lineral additions in n vars
     vec< lineral > linerals;
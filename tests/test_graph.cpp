@@ -20,22 +20,28 @@
 //file to test implementation of LHGR
 #include <vector>
 #include <set>
+#include <list>
+#include <random>
+#include <numeric>
 
 #include "../src/graph/graph.hpp"
+#include "../src/graph/reach_index.hpp"
+#include "../src/graph/topo_order.hpp"
+#include "../src/graph/traversal_ws.hpp"
 
 #include <catch2/catch_all.hpp>
 
 
-void CHECK_EQ_SET(vec<var_t> a, vec<var_t> b) {
-    CHECK(std::set<var_t>(a.begin(),a.end()) == std::set<var_t>(b.begin(),b.end()));
+void CHECK_EQ_SET(vec<vert_t> a, vec<vert_t> b) {
+    CHECK(std::set<vert_t>(a.begin(),a.end()) == std::set<vert_t>(b.begin(),b.end()));
 }
 
 
 TEST_CASE( "graph creation, edge-removal, and backtracking (small undirected graph, non-trivial sigma)", "[LHDGR]" ) {
     //cycle of length 3
-    vec<var_t> sigma = {1,0,3,2};
-    vec< std::pair<var_t,var_t>> E = {std::pair<var_t,var_t>(0,2),
-                                              std::pair<var_t,var_t>(1,3)};
+    vec<vert_t> sigma = {1,0,3,2};
+    vec< std::pair<vert_t,vert_t>> E = {std::pair<vert_t,vert_t>(0,2),
+                                              std::pair<vert_t,vert_t>(1,3)};
 
     graph G = graph(E,sigma.size());
 
@@ -74,10 +80,10 @@ TEST_CASE( "graph creation, edge-removal, and backtracking (small undirected gra
 /*
 TEST_CASE( "graph creation, edge-removal, and backtracking (small undirected graph, trivial sigma)", "[LHDGR]" ) {
     //cycle of length 3
-    vec<var_t> sigma = {0,1,2};
-    vec< std::pair<var_t,var_t>> E = {std::pair<var_t,var_t>(0,1),
-                                              std::pair<var_t,var_t>(1,2),
-                                              std::pair<var_t,var_t>(2,0)};
+    vec<vert_t> sigma = {0,1,2};
+    vec< std::pair<vert_t,vert_t>> E = {std::pair<vert_t,vert_t>(0,1),
+                                              std::pair<vert_t,vert_t>(1,2),
+                                              std::pair<vert_t,vert_t>(2,0)};
                                             
     graph G = graph(E,3);
 
@@ -105,10 +111,10 @@ TEST_CASE( "graph creation, edge-removal, and backtracking (small undirected gra
 
 TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (small directed graph, non-trivial sigma)", "[LHDGR]" ) {
     //cycle of length 3
-    vec<var_t> sigma = {1,0,3,2,5,4};
-    vec< std::pair<var_t,var_t>> E = {std::pair<var_t,var_t>(5,3),
-                                              std::pair<var_t,var_t>(4,0),
-                                              std::pair<var_t,var_t>(1,2)};
+    vec<vert_t> sigma = {1,0,3,2,5,4};
+    vec< std::pair<vert_t,vert_t>> E = {std::pair<vert_t,vert_t>(5,3),
+                                              std::pair<vert_t,vert_t>(4,0),
+                                              std::pair<vert_t,vert_t>(1,2)};
 
     graph G = graph(E,6);
 
@@ -118,18 +124,18 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
         
     graph_repr G_orig = G.get_state();
     
-    CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-    CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({3,4}) );
-    CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({5,2}) );
-    CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-    CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<var_t>({4}) );
-    CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<var_t>({1}) );
-    CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<var_t>({0}) );
-    CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<var_t>({5}) );
-    CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({0}) );
-    CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({2}) );
-    CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<var_t>({3}) );
-    CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<var_t>({1}) );
+    CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+    CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({3,4}) );
+    CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({5,2}) );
+    CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+    CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<vert_t>({4}) );
+    CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<vert_t>({1}) );
+    CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<vert_t>({0}) );
+    CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<vert_t>({5}) );
+    CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({0}) );
+    CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({2}) );
+    CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<vert_t>({3}) );
+    CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<vert_t>({1}) );
 
 
     SECTION("remove_edge") {
@@ -142,18 +148,18 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
 
         CHECK(G.to_str() == "(1,2) (1,5); (3,0); (4,0)");
 
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({4,3}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({5,2}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<var_t>({1}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<var_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({4,3}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({5,2}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<vert_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<vert_t>({1}) );
     };
     
     SECTION("remove_edge") {
@@ -166,18 +172,18 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
 
         CHECK( G.to_str() == "(1,2); (2,4); (3,0); (5,3)");
         
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({3}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({2}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<var_t>({4}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<var_t>({1}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<var_t>({5}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({2}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<var_t>({3}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<var_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({3}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({2}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<vert_t>({4}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<vert_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<vert_t>({5}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({2}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<vert_t>({3}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<vert_t>({}) );
     };
     
     SECTION("remove_edge") {
@@ -190,18 +196,18 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
 
         CHECK( G.to_str() == "(1,5); (2,4); (4,0); (5,3)");
 
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({4}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({5}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<var_t>({4}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<var_t>({5}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({2}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<var_t>({3}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<var_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({4}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({5}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<vert_t>({4}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<vert_t>({5}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({2}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<vert_t>({3}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<vert_t>({1}) );
     };
     
     SECTION("remove_vert") {
@@ -211,18 +217,18 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
 
         CHECK( G.to_str() == "(2,4); (5,3)");
         
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<var_t>({4}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<var_t>({5}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({2}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<var_t>({3}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<var_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<vert_t>({4}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<vert_t>({5}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({2}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<vert_t>({3}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<vert_t>({}) );
     }
     
     SECTION("remove_vert") {
@@ -232,18 +238,18 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
 
         CHECK( G.to_str() == "(2,4); (5,3)");
         
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<var_t>({4}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<var_t>({5}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({2}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<var_t>({3}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<var_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<vert_t>({4}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<vert_t>({5}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({2}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<vert_t>({3}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<vert_t>({}) );
     }
     
     SECTION("remove_vert") {
@@ -255,18 +261,18 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
 
         CHECK( G.to_str() == "(1,2); (3,0)");
 
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({3}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({2}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<var_t>({1}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<var_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({3}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({2}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<vert_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<vert_t>({}) );
     }
     
     SECTION("vertex_merging") {
@@ -282,14 +288,14 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
         CHECK_EQ_SET( G.get_out_neighbour_vector(1), G.get_out_neighbour_vector(2) );
         CHECK_EQ_SET( G.get_in_neighbour_vector(1), G.get_in_neighbour_vector(2) );
         #endif
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({5,4}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({4,5}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({1}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<var_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({5,4}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({4,5}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<vert_t>({1}) );
     }
     #ifdef USE_LHGR //merging symmetric verts not supported!
     SECTION("vertex_merging (symmetric pair!)") {
@@ -299,18 +305,18 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
 
         CHECK( G.to_str() == "(1,2) (1,4); (2,4); (3,0); (4,0) (4,3)" );
         
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({4,3}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({4,2}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<var_t>({4}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<var_t>({1}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<var_t>({4}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({4,3}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({4,2}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(2), vec<vert_t>({4}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(2), vec<vert_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(3), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(3), vec<vert_t>({4}) );
         CHECK_EQ_SET( G.get_out_neighbour_vector(4), G.get_out_neighbour_vector(5) );
         CHECK_EQ_SET( G.get_in_neighbour_vector(4), G.get_in_neighbour_vector(5) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({0,3}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({1,2}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({0,3}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({1,2}) );
     }
     #endif
     
@@ -330,14 +336,14 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
         CHECK_EQ_SET( G.get_in_neighbour_vector(0), G.get_in_neighbour_vector(3) );
         CHECK_EQ_SET( G.get_out_neighbour_vector(1), G.get_out_neighbour_vector(2) );
         CHECK_EQ_SET( G.get_in_neighbour_vector(1), G.get_in_neighbour_vector(2) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({4}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({4}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({4}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({4}) );
         CHECK_EQ_SET( G.get_out_neighbour_vector(4), G.get_out_neighbour_vector(5) );
         CHECK_EQ_SET( G.get_in_neighbour_vector(4), G.get_in_neighbour_vector(5) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({1}) );
         #endif
     }
     
@@ -363,10 +369,10 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
         CHECK_EQ_SET( G.get_out_neighbour_vector(1), G.get_out_neighbour_vector(2) );
         CHECK_EQ_SET( G.get_in_neighbour_vector(1), G.get_in_neighbour_vector(2) );
         #endif
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({1}) );
         #ifdef USE_LHGR
         CHECK_EQ_SET( G.get_out_neighbour_vector(4), G.get_out_neighbour_vector(2) );
         CHECK_EQ_SET( G.get_in_neighbour_vector(4), G.get_in_neighbour_vector(2) );
@@ -385,14 +391,14 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
         CHECK_EQ_SET( G.get_out_neighbour_vector(1), G.get_out_neighbour_vector(2) );
         CHECK_EQ_SET( G.get_in_neighbour_vector(1), G.get_in_neighbour_vector(2) );
         #endif
-        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<var_t>({5,4}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<var_t>({}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<var_t>({4,5}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<var_t>({1}) );
-        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<var_t>({0}) );
-        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<var_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(1), vec<vert_t>({5,4}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(1), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(0), vec<vert_t>({}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(0), vec<vert_t>({4,5}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(4), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(4), vec<vert_t>({1}) );
+        CHECK_EQ_SET( G.get_out_neighbour_vector(5), vec<vert_t>({0}) );
+        CHECK_EQ_SET( G.get_in_neighbour_vector(5), vec<vert_t>({1}) );
     }
     
     G.backtrack( std::move(G_orig) );
@@ -403,8 +409,8 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (smal
 }
 
 TEST_CASE( "edge case in vertex-merging", "[LHDGR]" ) {
-    vec<var_t> sigma = {1,0,3,2};
-    vec< std::pair<var_t,var_t>> E = {std::pair<var_t,var_t>(0,2)};
+    vec<vert_t> sigma = {1,0,3,2};
+    vec< std::pair<vert_t,vert_t>> E = {std::pair<vert_t,vert_t>(0,2)};
 
     graph G = graph(E,4);
     
@@ -437,13 +443,13 @@ TEST_CASE( "edge case in vertex-merging", "[LHDGR]" ) {
 
 TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (longer non-trivial example)", "[LHDGR]" ) {
     //cycle of length 3
-    vec<var_t> sigma = {1,0,3,2,5,4,7,6,9,8,11,10};
-    vec< std::pair<var_t,var_t>> E = {std::pair<var_t,var_t>(0,10),
-                                              std::pair<var_t,var_t>(3,9),
-                                              std::pair<var_t,var_t>(2,4),
-                                              std::pair<var_t,var_t>(6,7),
-                                              std::pair<var_t,var_t>(6,1),
-                                              std::pair<var_t,var_t>(8,5)};
+    vec<vert_t> sigma = {1,0,3,2,5,4,7,6,9,8,11,10};
+    vec< std::pair<vert_t,vert_t>> E = {std::pair<vert_t,vert_t>(0,10),
+                                              std::pair<vert_t,vert_t>(3,9),
+                                              std::pair<vert_t,vert_t>(2,4),
+                                              std::pair<vert_t,vert_t>(6,7),
+                                              std::pair<vert_t,vert_t>(6,1),
+                                              std::pair<vert_t,vert_t>(8,5)};
 
     auto state_str_stack = std::list< std::pair<graph_repr, std::string> >();
 
@@ -454,7 +460,7 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
         );
     CHECK( G.to_str() == state_str_stack.back().second );
     CHECK( G.assert_data_structs() );
-    CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5,6,7,8,9,10,11}) );
+    CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5,6,7,8,9,10,11}) );
 
     #ifdef USE_LHGR
     SECTION("edge cases...") {
@@ -464,13 +470,13 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
 
         CHECK( G.to_str() == "(0,6) (0,10); (2,4); (3,9); (4,9); (5,3); (6,1); (8,2) (8,5); (11,1)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5,6,8,9,10,11}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5,6,8,9,10,11}) );
 
         G.backtrack( std::move(G_orig) );
         
         CHECK( G.to_str() == "(0,7) (0,10); (2,4); (3,9); (4,9); (5,3); (6,1) (6,7); (8,2) (8,5); (11,1)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5,6,7,8,9,10,11}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5,6,7,8,9,10,11}) );
     }
     #endif
 
@@ -481,7 +487,7 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
     CHECK( G.get_no_e() == 11 );
     CHECK( G.to_str() == state_str_stack.back().second );
     CHECK( G.assert_data_structs() );
-    CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5,6,7,8,9}) );
+    CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5,6,7,8,9}) );
     
     G.merge_verts(1,9); //merge 1,9 and 0,8
     state_str_stack.push_back( 
@@ -490,7 +496,7 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
     CHECK( G.get_no_e() == 9 );
     CHECK( G.to_str() == state_str_stack.back().second );
     CHECK( G.assert_data_structs() );
-    CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5,6,7}) );
+    CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5,6,7}) );
 
     SECTION("in-between vertex-deletion + backtracking") {
         graph_repr G_orig = G.get_state();
@@ -499,13 +505,13 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
 
         CHECK( G.to_str() == "(0,2) (0,5); (2,4); (3,1); (4,1); (5,3)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5}) );
 
         G.backtrack( std::move(G_orig) );
 
         CHECK( G.to_str() == "(0,2) (0,5) (0,7); (2,4); (3,1); (4,1); (5,3); (6,1) (6,7)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5,6,7}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5,6,7}) );
     }
 
     SECTION("in-between vertex-deletion + backtracking") {
@@ -515,13 +521,13 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
 
         CHECK( G.to_str() == "(2,4); (5,3); (6,7)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({2,3,4,5,6,7}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({2,3,4,5,6,7}) );
 
         G.backtrack( std::move(G_orig) );
         
         CHECK( G.to_str() == "(0,2) (0,5) (0,7); (2,4); (3,1); (4,1); (5,3); (6,1) (6,7)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5,6,7}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5,6,7}) );
     }
 
     G.merge_verts(1,6); //merge 1,6 and 0,7
@@ -531,7 +537,7 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
     CHECK( G.get_no_e() == 7 );
     CHECK( G.to_str() == state_str_stack.back().second );
     CHECK( G.assert_data_structs() );
-    CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5}) );
+    CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5}) );
 
 
     SECTION("in-between vertex-deletion + backtracking") {
@@ -541,13 +547,13 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
 
         CHECK( G.to_str() == "(2,4); (5,3)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({2,3,4,5}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({2,3,4,5}) );
 
         G.backtrack( std::move(G_orig) );
         
         CHECK( G.to_str() == "(0,2) (0,5); (1,0); (2,4); (3,1); (4,1); (5,3)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({0,1,2,3,4,5}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5}) );
     }
 
     G.merge_verts(5,1); //merge 1,5 and 0,4
@@ -557,7 +563,7 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
     CHECK( G.get_no_e() == 6 );
     CHECK( G.to_str() == state_str_stack.back().second );
     CHECK( G.assert_data_structs() );
-    CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({2,3,4,5}) );
+    CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({2,3,4,5}) );
 
     SECTION("in-between vertex-deletion + backtracking") {
         graph_repr G_orig = G.get_state();
@@ -566,13 +572,13 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
 
         CHECK( G.to_str() == "(4,5); (5,4)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({4,5}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({4,5}) );
 
         G.backtrack( std::move(G_orig) );
         
         CHECK( G.to_str() == "(2,4); (3,5); (4,2) (4,5); (5,3) (5,4)" );
         CHECK( G.assert_data_structs() );
-        CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({2,3,4,5}) );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({2,3,4,5}) );
     }
 
     G.merge_verts(3,5); //merge 3 and 5
@@ -582,7 +588,7 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
     CHECK( G.get_no_e() == 2 );
     CHECK( G.to_str() == state_str_stack.back().second );
     CHECK( G.assert_data_structs() );
-    CHECK_EQ_SET( G.get_v_vector(), vec<var_t>({2,3}) );
+    CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({2,3}) );
 
 
     //check backtracking!
@@ -595,4 +601,415 @@ TEST_CASE( "graph creation, edge-removal, vertex merging, and backtracking (long
         CHECK( G.assert_data_structs() );
     }
 
-}
\ No newline at end of file
+}
+
+//computes a topological ordering via Kahn's algorithm
+vec<vert_t> TO_of(const graph& G) {
+    vec<vert_t> in_deg(G.get_no_v_total(), 0);
+    vec<vert_t> to;
+    for(const auto& v : G.get_v_range()) {
+        in_deg[v] = G.get_in_degree(v);
+        if(in_deg[v] == 0) to.push_back(v);
+    }
+    for(vert_t i = 0; i < to.size(); ++i) {
+        for(const auto& w : G.get_out_neighbour_range(to[i])) if(--in_deg[w] == 0) to.push_back(w);
+    }
+    return to;
+}
+
+//computes reachability via plain DFS
+bool reaches(const graph& G, const vert_t src, const vert_t dst) {
+    vec<bool> visited(G.get_no_v_total(), false);
+    vec<vert_t> st({src});
+    while(!st.empty()) {
+        const vert_t v = st.back();
+        st.pop_back();
+        if(v == dst) return true;
+        if(visited[v]) continue;
+        visited[v] = true;
+        for(const auto& w : G.get_out_neighbour_range(v)) st.push_back(w);
+    }
+    return false;
+}
+
+TEST_CASE( "reachability index", "[LHDGR][reach]" ) {
+    //DAG with shared substructure: 0->2, 0->4, 2->6, 4->6, 6->8, 8->10, 4->10 (and their symmetric edges)
+    vec< std::pair<vert_t,vert_t>> E = {std::pair<vert_t,vert_t>(0,2),
+                                      std::pair<vert_t,vert_t>(0,4),
+                                      std::pair<vert_t,vert_t>(2,6),
+                                      std::pair<vert_t,vert_t>(4,6),
+                                      std::pair<vert_t,vert_t>(6,8),
+                                      std::pair<vert_t,vert_t>(8,10),
+                                      std::pair<vert_t,vert_t>(4,10)};
+
+    graph G = graph(E,12);
+    const auto TO = TO_of(G);
+    CHECK( TO.size() == 12 );
+
+    SECTION("without sources") {
+        reach_index RI(G, TO);
+        CHECK( RI.get_no_sources() == 0 );
+        for(vert_t v = 0; v < 12; ++v) {
+            for(vert_t w = 0; w < 12; ++w) CHECK( RI.is_descendant(v,w) == reaches(G,v,w) );
+        }
+    }
+
+    SECTION("with sources") {
+        reach_index RI(G, TO, G.get_v_vector());
+        CHECK( RI.get_no_sources() == 12 );
+        for(vert_t v = 0; v < 12; ++v) {
+            for(vert_t w = 0; w < 12; ++w) CHECK( RI.is_descendant(v,w) == reaches(G,v,w) );
+        }
+        CHECK( RI.is_descendant(0,10) );
+        CHECK( RI.is_descendant(11,1) );
+        CHECK( !RI.is_descendant(2,4) );
+        CHECK( !RI.is_descendant(10,0) );
+    }
+
+    SECTION("after vertex removal") {
+        G.remove_vert(6);
+        const auto TO_ = TO_of(G);
+        reach_index RI(G, TO_, vec<vert_t>({0,2}));
+        CHECK( !RI.is_descendant(0,8) );
+        CHECK( RI.is_descendant(0,10) );
+        CHECK( !RI.is_descendant(2,10) );
+    }
+}
+
+#ifdef USE_LHGR
+TEST_CASE( "edge insertion and backtracking", "[LHDGR]" ) {
+    vec< std::pair<vert_t,vert_t>> E = {std::pair<vert_t,vert_t>(0,10),
+                                              std::pair<vert_t,vert_t>(3,9),
+                                              std::pair<vert_t,vert_t>(2,4),
+                                              std::pair<vert_t,vert_t>(6,7),
+                                              std::pair<vert_t,vert_t>(6,1),
+                                              std::pair<vert_t,vert_t>(8,5)};
+
+    graph G = graph(E,12);
+    graph_repr G_orig = G.get_state();
+    const std::string G_orig_str = G.to_str();
+    CHECK( G_orig_str == "(0,7) (0,10); (2,4); (3,9); (4,9); (5,3); (6,1) (6,7); (8,2) (8,5); (11,1)" );
+
+    //insertion at level 0
+    CHECK( G.add_edge(2,10) );
+    CHECK( !G.add_edge(2,10) );
+    CHECK( !G.add_edge(11,3) );
+    CHECK( G.get_no_e() == 13 );
+    CHECK( G.to_str() == "(0,7) (0,10); (2,4) (2,10); (3,9); (4,9); (5,3); (6,1) (6,7); (8,2) (8,5); (11,1) (11,3)" );
+    CHECK( G.assert_data_structs() );
+    graph_repr G_lvl0 = G.get_state();
+    const std::string G_lvl0_str = G.to_str();
+
+    SECTION("insertion after vertex removal") {
+        G.remove_vert(6); //removes 6 and 7; AL_out[0] keeps 0->7 out-of-scope
+        graph_repr G_lvl1 = G.get_state();
+        const std::string G_lvl1_str = G.to_str();
+        CHECK( G_lvl1_str == "(0,10); (2,4) (2,10); (3,9); (4,9); (5,3); (8,2) (8,5); (11,1) (11,3)" );
+
+        CHECK( G.add_edge(0,2) );
+        CHECK( G.add_edge(4,5) ); //self-symmetric edge
+        CHECK( G.to_str() == "(0,2) (0,10); (2,4) (2,10); (3,1) (3,9); (4,5) (4,9); (5,3); (8,2) (8,5); (11,1) (11,3)" );
+        CHECK( G.assert_data_structs() );
+
+        G.merge_verts(1,9); //merge 1,9 and 0,8
+        CHECK( G.add_edge(0,4) );
+        CHECK( G.assert_data_structs() );
+        G.remove_vert(3);
+        CHECK( G.assert_data_structs() );
+
+        G.backtrack( std::move(G_lvl1) );
+        CHECK( G.to_str() == G_lvl1_str );
+        CHECK( G.assert_data_structs() );
+        CHECK_EQ_SET( G.get_v_vector(), vec<vert_t>({0,1,2,3,4,5,8,9,10,11}) );
+
+        G.remove_vert(2);
+        CHECK( G.to_str() == "(0,10); (4,9); (8,5); (11,1)" );
+    }
+
+    SECTION("insertion into merged colors") {
+        G.merge_verts(5,10); //merge 5,10 and 4,11
+        graph_repr G_lvl1 = G.get_state();
+        const std::string G_lvl1_str = G.to_str();
+
+        CHECK( !G.add_edge(10,3) );
+        CHECK( G.add_edge(11,5) ); //self-symmetric on colors
+        CHECK( G.get_no_e() == G_lvl1.no_e+1 );
+        CHECK( G.assert_data_structs() );
+        CHECK( G.add_edge(3,6) );
+        CHECK( G.assert_data_structs() );
+
+        G.backtrack( std::move(G_lvl1) );
+        CHECK( G.to_str() == G_lvl1_str );
+        CHECK( G.assert_data_structs() );
+    }
+
+    //level-0 insertion survives backtracking to later states
+    G.backtrack( std::move(G_lvl0) );
+    CHECK( G.to_str() == G_lvl0_str );
+    CHECK( G.assert_data_structs() );
+
+    //... but not to older states
+    G.backtrack( std::move(G_orig) );
+    CHECK( G.to_str() == G_orig_str );
+    CHECK( G.assert_data_structs() );
+}
+
+TEST_CASE( "edge insertion and backtracking (random operations)", "[LHDGR]" ) {
+    const vert_t n = 40;
+    std::mt19937 gen(42);
+    vec< std::pair<vert_t,vert_t>> E;
+    for(vert_t i = 0; i < n; ++i) {
+        const vert_t v = gen() % n;
+        const vert_t w = gen() % n;
+        if(v != w && SIGMA(v) != w) E.emplace_back(v, w);
+    }
+    graph G = graph(E, n);
+
+    std::list< std::pair<graph_repr, std::string> > states;
+    for(vert_t i = 0; i < 400; ++i) {
+        const auto vs = G.get_v_vector();
+        const vert_t op = gen() % 8;
+        if(vs.size() < 4 || (op == 0 && !states.empty())) {
+            //backtrack to some stored state
+            if(states.empty()) break;
+            const vert_t k = gen() % states.size();
+            while(states.size() > k+1) states.pop_back();
+            G.backtrack( std::move(states.back().first) );
+            CHECK( G.to_str() == states.back().second );
+            states.pop_back();
+        } else if(op < 3) {
+            states.emplace_back( G.get_state(), G.to_str() );
+        } else if(op < 6) {
+            const vert_t v = vs[gen() % vs.size()];
+            const vert_t w = vs[gen() % vs.size()];
+            if(v != w && v != SIGMA(w)) G.add_edge(v, w);
+        } else if(op == 6) {
+            const vert_t v = vs[gen() % vs.size()];
+            const vert_t w = vs[gen() % vs.size()];
+            if(v != w && v != SIGMA(w)) G.merge_verts(v, w);
+        } else {
+            G.remove_vert( vs[gen() % vs.size()] );
+        }
+        CHECK( G.assert_data_structs() );
+    }
+    while(!states.empty()) {
+        G.backtrack( std::move(states.back().first) );
+        CHECK( G.to_str() == states.back().second );
+        states.pop_back();
+    }
+}
+
+TEST_CASE( "copy-on-write snapshots spanning several pages (random operations)", "[LHDGR]" ) {
+    const vert_t n = 5*LHGR_PAGE_SIZE+6;
+    std::mt19937 gen(17);
+    vec< std::pair<vert_t,vert_t>> E;
+    for(vert_t i = 0; i < 3*n; ++i) {
+        const vert_t v = gen() % n;
+        const vert_t w = gen() % n;
+        if(v != w && SIGMA(v) != w) E.emplace_back(v, w);
+    }
+    graph G = graph(E, n);
+
+    //states are nested as on graph_stack; each state is backtracked at most once
+    std::list< std::pair<graph_repr, std::string> > states;
+    for(vert_t i = 0; i < 1500; ++i) {
+        const auto vs = G.get_v_vector();
+        const vert_t op = gen() % 10;
+        if(vs.size() < 4 || op == 0) {
+            if(states.empty()) break;
+            G.backtrack( std::move(states.back().first) );
+            CHECK( G.to_str() == states.back().second );
+            states.pop_back();
+        } else if(op < 3) {
+            states.emplace_back( G.get_state(), G.to_str() );
+        } else if(op < 5) {
+            const vert_t v = vs[gen() % vs.size()];
+            const vert_t w = vs[gen() % vs.size()];
+            if(v != w && v != SIGMA(w)) G.add_edge(v, w);
+        } else if(op < 9) {
+            const vert_t v = vs[gen() % vs.size()];
+            const vert_t w = vs[gen() % vs.size()];
+            if(v != w && v != SIGMA(w)) G.merge_verts(v, w);
+        } else {
+            G.remove_vert( vs[gen() % vs.size()] );
+        }
+        CHECK( G.assert_data_structs() );
+    }
+    while(!states.empty()) {
+        G.backtrack( std::move(states.back().first) );
+        CHECK( G.to_str() == states.back().second );
+        states.pop_back();
+    }
+}
+#endif
+
+TEST_CASE( "batch vertex merging (random operations)", "[LHDGR]" ) {
+    std::mt19937 gen(23);
+    for(vert_t r = 0; r < 40; ++r) {
+        const vert_t n = 2*(5 + gen() % 100);
+        vec< std::pair<vert_t,vert_t>> E;
+        for(vert_t i = 0; i < 2*n; ++i) {
+            const vert_t v = gen() % n;
+            const vert_t w = gen() % n;
+            if(v != w && SIGMA(v) != w) E.emplace_back(v, w);
+        }
+        graph G_seq = graph(E, n);
+        graph G_batch = graph(E, n);
+
+        const auto state_seq = G_seq.get_state();
+        const auto state_batch = G_batch.get_state();
+        const std::string str = G_seq.to_str();
+        //union-find on verts, to avoid merging a vertex with its symmetric counterpart
+        vec<vert_t> rt(n);
+        std::iota(rt.begin(), rt.end(), 0);
+        const auto find = [&rt](vert_t v) { while(rt[v] != v) v = rt[v]; return v; };
+        for(vert_t round = 0; round < 4; ++round) {
+            const auto vs = G_seq.get_v_vector();
+            if(vs.size() < 4) break;
+            //merge lists may contain chains and pairs that are already merged by earlier pairs of the list; only symmetric merges are avoided
+            vec< std::pair<vert_t,vert_t> > merge_list;
+            for(vert_t k = gen() % (vs.size()/2); k > 0; --k) {
+                const vert_t v = vs[gen() % vs.size()];
+                const vert_t w = vs[gen() % vs.size()];
+                if(find(v) == find(SIGMA(w))) continue;
+                merge_list.emplace_back(v, w);
+                rt[find(v)] = find(w);
+                rt[find(SIGMA(v))] = find(SIGMA(w));
+            }
+            for(const auto &[v, w] : merge_list) G_seq.merge_verts(v, w);
+            G_batch.merge_verts(merge_list);
+
+            CHECK( G_batch.to_str() == G_seq.to_str() );
+            CHECK( G_batch.get_no_v() == G_seq.get_no_v() );
+            CHECK( G_batch.get_no_e() == G_seq.get_no_e() );
+            CHECK( G_batch.assert_data_structs() );
+        }
+        G_seq.backtrack( graph_repr(state_seq) );
+        G_batch.backtrack( graph_repr(state_batch) );
+        CHECK( G_seq.to_str() == str );
+        CHECK( G_batch.to_str() == str );
+    }
+}
+
+TEST_CASE( "dynamic topological order", "[LHDGR][topo]" ) {
+    //DAG: 0->2, 2->4, 4->6, 0->8 (and their symmetric edges)
+    vec< std::pair<vert_t,vert_t>> E = {std::pair<vert_t,vert_t>(0,2),
+                                      std::pair<vert_t,vert_t>(2,4),
+                                      std::pair<vert_t,vert_t>(4,6),
+                                      std::pair<vert_t,vert_t>(0,8)};
+    graph G = graph(E,10);
+    topo_order T;
+    CHECK( T.init(G) );
+    CHECK( T.assert_data_structs(G) );
+    CHECK( T.get_TO(G).size() == 10 );
+
+    const auto g_state = G.get_state();
+    const auto t_state = T.get_state();
+    const auto TO = T.get_TO(G);
+
+    SECTION("merge without cycle") {
+        //merged vert must be placed after 2 and before 6
+        G.merge_verts(8,4);
+        T.merge(G,8,4);
+        CHECK( T.update(G) );
+        CHECK( T.assert_data_structs(G) );
+        CHECK( T.get_TO(G).size() == G.get_no_v() );
+    }
+
+    SECTION("merge with cycle") {
+        //merging 6 and 2 creates the cycle 6->4->6
+        G.merge_verts(6,2);
+        T.merge(G,6,2);
+        CHECK( !T.update(G) );
+        CHECK( !T.is_valid() );
+        CHECK( TO_of(G).size() < G.get_no_v() );
+        //further merges are ignored
+        G.merge_verts(0,8);
+        T.merge(G,0,8);
+        CHECK( !T.update(G) );
+        //removing the cycle makes it a DAG again
+        G.remove_vert(4);
+        CHECK( T.recompute(G) );
+        CHECK( T.assert_data_structs(G) );
+    }
+
+    //backtracking restores order
+    G.backtrack( graph_repr(g_state) );
+    T.backtrack( topo_order_repr(t_state) );
+    CHECK( T.is_valid() );
+    CHECK( T.get_TO(G) == TO );
+}
+
+TEST_CASE( "dynamic topological order (random operations)", "[LHDGR][topo]" ) {
+    const vert_t n = 60;
+    std::mt19937 gen(7);
+    //random skew-symmetric DAG: edges respect the rank 2i -> i, 2i+1 -> n-1-i
+    const auto rank = [](const vert_t v) { return (v%2==0) ? v/2 : n-1-v/2; };
+    vec< std::pair<vert_t,vert_t>> E;
+    for(vert_t i = 0; i < 2*n; ++i) {
+        const vert_t v = gen() % n;
+        const vert_t w = gen() % n;
+        if(rank(v) < rank(w) && SIGMA(v) != w) E.emplace_back(v, w);
+    }
+    graph G = graph(E, n);
+    topo_order T;
+    CHECK( T.init(G) );
+
+    std::list< std::tuple<graph_repr, topo_order_repr, vec<vert_t>> > states;
+    for(vert_t i = 0; i < 600; ++i) {
+        const auto vs = G.get_v_vector();
+        const vert_t op = gen() % 8;
+        if(vs.size() < 6 || (op == 0 && !states.empty())) {
+            //backtrack to some stored state
+            if(states.empty()) break;
+            const vert_t k = gen() % states.size();
+            while(states.size() > k+1) states.pop_back();
+            auto& [g_state, t_state, TO] = states.back();
+            G.backtrack( std::move(g_state) );
+            T.backtrack( std::move(t_state) );
+            CHECK( T.is_valid() == !TO.empty() );
+            if(T.is_valid()) CHECK( T.get_TO(G) == TO );
+            states.pop_back();
+        } else if(op < 3) {
+            states.emplace_back( G.get_state(), T.get_state(), T.is_valid() ? T.get_TO(G) : vec<vert_t>() );
+        } else if(op < 7) {
+            //batch of merges
+            const bool was_valid = T.is_valid();
+            for(vert_t j = 0; j < op-2; ++j) {
+                const auto vs_ = G.get_v_vector();
+                const vert_t v = vs_[gen() % vs_.size()];
+                const vert_t w = vs_[gen() % vs_.size()];
+                if(v == w || v == SIGMA(w)) continue;
+                G.merge_verts(v, w);
+                T.merge(G, v, w);
+            }
+            T.update(G);
+            //cycles are detected iff they are created
+            if(was_valid) CHECK( T.is_valid() == (TO_of(G).size() == G.get_no_v()) );
+        } else {
+            G.remove_vert( vs[gen() % vs.size()] );
+            if(!T.is_valid()) T.recompute(G);
+        }
+        CHECK( T.assert_data_structs(G) );
+        CHECK( T.is_valid() == (TO_of(G).size() == G.get_no_v()) );
+    }
+}
+
+TEST_CASE( "epoch-stamped marks", "[traversal_ws]" ) {
+    epoch_marks m;
+    m.clear(10);
+    for(vert_t i = 0; i < 10; ++i) CHECK( !m.is_marked(i) );
+    m.mark(3);
+    m.mark(7);
+    CHECK( m.is_marked(3) );
+    CHECK( m.is_marked(7) );
+    CHECK( !m.is_marked(4) );
+    m.unmark(7);
+    CHECK( !m.is_marked(7) );
+
+    //clearing unmarks everything, growing keeps new indices unmarked
+    m.clear(20);
+    for(vert_t i = 0; i < 20; ++i) CHECK( !m.is_marked(i) );
+    m.mark(15);
+    CHECK( m.is_marked(15) );
+}
@@ -0,0 +1,209 @@
+// Copyright (c) 2022-2023 Julian Danner <julian.danner@uni-passau.de>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of
+// this software and associated documentation files (the "Software"), to deal in
+// the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+// the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+//file to test implementation of hash-consed linerals and vertex labels
+#include "../src/LA/lineral_store.hpp"
+#include "../src/vl/vl_hcons.hpp"
+
+#include <catch2/catch_all.hpp>
+
+
+TEST_CASE( "lineral store intern/sum/truncate", "[hcons]" ) {
+    lineral_store st;
+    CHECK( st.size() == 1 );
+    CHECK( st.get(LID_ZERO) == lineral() );
+    CHECK( st.get(LID_ZERO|1) == lineral({0}) );
+
+    lineral f = lineral({1,2,3});
+    lineral g = lineral({0,2,3});
+    lineral h = lineral({0,4});
+
+    const lid_t id_f = st.intern(f);
+    const lid_t id_g = st.intern(g);
+    CHECK( st.size() == 3 );
+    CHECK( (id_f & 1) == 0 );
+    CHECK( (id_g & 1) == 1 );
+    //f+1 and g+1 share the index of f and g, resp.
+    CHECK( st.intern(f.plus_one()) == (id_f|1) );
+    CHECK( st.intern(g.plus_one()) == (id_g^1) );
+    CHECK( st.size() == 3 );
+    CHECK( st.find(f) == id_f );
+    CHECK( st.find(h) == NO_LID );
+
+    CHECK( st.get(id_f) == f );
+    CHECK( st.get(id_g) == g );
+    CHECK( st.get_(id_g) == g.plus_one() );
+    CHECK( st.LT(id_f) == 1 );
+    CHECK( st.LT(id_g) == 2 );
+
+    //sums
+    const lid_t id_s = st.sum(id_f, id_g);
+    CHECK( st.get(id_s) == f+g );
+    CHECK( st.size() == 4 );
+    CHECK( st.num_sums() == 1 );
+    CHECK( st.sum(id_g, id_f) == id_s );
+    CHECK( st.sum(id_f|1, id_g) == (id_s^1) );
+    CHECK( st.num_sums() == 1 );
+    CHECK( st.sum(id_f, id_f|1) == (LID_ZERO|1) );
+    CHECK( st.sum(LID_ZERO|1, id_g) == (id_g^1) );
+    CHECK( st.size() == 4 );
+
+    //truncate
+    CHECK( st.intern(h) == ((4<<1)|1) );
+    CHECK( st.size() == 5 );
+    st.truncate(3);
+    CHECK( st.size() == 3 );
+    CHECK( st.num_sums() == 0 );
+    CHECK( st.find(h) == NO_LID );
+    CHECK( st.find(f+g) == NO_LID );
+    CHECK( st.get(id_f) == f );
+    CHECK( st.intern(h) == ((3<<1)|1) );
+
+    //copies are independent
+    lineral_store st_cpy(st);
+    st.truncate(1);
+    CHECK( st_cpy.size() == 4 );
+    CHECK( st_cpy.get(id_g) == g );
+    CHECK( st_cpy.find(h) == ((3<<1)|1) );
+}
+
+
+TEST_CASE( "hcons insert/update/erase", "[hcons]" ) {
+    vl_hcons vl(4,4);
+
+    lineral l1 = lineral({0,1,2,3});
+    lineral l2 = lineral({2,3});
+    lineral l3 = lineral({0,1,2});
+
+    auto ins1 = vl.insert(0, l1, 0);
+    auto ins2 = vl.insert(1, l2, 0);
+    auto ins3 = vl.insert(2, l3, 0);
+    CHECK( ins1.inserted );
+    CHECK( ins2.inserted );
+    CHECK( ins3.inserted );
+    CHECK( vl.size() == 3 );
+    CHECK( vl.to_str() == "(0,x1+x2+x3+1) (1,x2+x3) (2,x1+x2+1)" );
+
+    CHECK( vl[0] == l1 );
+    CHECK( vl.at(2) == l3 );
+    CHECK( vl[l2] == 1 );
+    CHECK( vl.at(l3) == 2 );
+    CHECK( vl[l1+l2] == 0 );
+    CHECK_THROWS( vl.at(l1+l2) );
+    CHECK_THROWS( vl.at(3) );
+
+    //containment is exact, V_contains and V ignore the constant
+    CHECK( vl.contains(l1) );
+    CHECK( !vl.contains(l1.plus_one()) );
+    CHECK( vl.V_contains(l1.plus_one()) );
+    CHECK( vl.V(l1) == 0 );
+    CHECK( vl.V(l1.plus_one()) == SIGMA(0) );
+    CHECK( vl.Vxlit(SIGMA(2)) == l3.plus_one() );
+    CHECK( vl.Vxlit_LT(SIGMA(2)) == 1 );
+    CHECK( vl.sum(0, 2) == l1+l3 );
+
+    //failing inserts
+    {
+        auto ins = vl.insert(0, lineral({1}), 0);
+        CHECK( !ins.inserted );
+        CHECK( ins.vert == 0 );
+    }
+    {
+        auto ins = vl.insert(4, l2.plus_one(), 0);
+        CHECK( !ins.inserted );
+        CHECK( ins.found_plus_one );
+        CHECK( ins.vert == 1 );
+    }
+    CHECK( vl.size() == 3 );
+
+    //update onto existing label
+    auto [v,b] = vl.update(2, l1.plus_one(), 0);
+    CHECK( v == 0 );
+    CHECK( b );
+    CHECK( !vl.contains(2) );
+    CHECK( vl.to_str() == "(0,x1+x2+x3+1) (1,x2+x3)" );
+
+    //zero
+    CHECK( !std::get<0>(vl.if_exists_get_zero_v()) );
+    vl.update(1, lineral({0}), 0);
+    const auto [has_zero,is_one,v_zero] = vl.if_exists_get_zero_v();
+    CHECK( has_zero );
+    CHECK( is_one );
+    CHECK( v_zero == 1 );
+
+    CHECK( vl.erase(0) );
+    CHECK( vl.to_str() == "(1,1)" );
+    CHECK( vl.size() == 1 );
+}
+
+
+TEST_CASE( "hcons backtracking and garbage collection", "[hcons]" ) {
+    vl_hcons vl(8,5);
+    const vec<lineral> lits = { lineral({1,2}), lineral({0,2,3}), lineral({3,4}), lineral({1,5}) };
+    for(vert_t i = 0; i < lits.size(); ++i) CHECK( vl.insert(2*i, lits[i], 0).inserted );
+    const std::string str0 = vl.to_str();
+    const lid_t n0 = vl.get_num_linerals();
+
+    //level 1: update label of 0, sums are memoized
+    auto r1 = vl.get_state();
+    vl.update(0, lineral({1,4}), 1);
+    CHECK( vl.sum(0, 4) == lineral({1,3}) );
+    const std::string str1 = vl.to_str();
+
+    //level 2: erase 2, merge 4 into 6, insert new label for 8
+    auto r2 = vl.get_state();
+    vl.erase(2);
+    auto [v,b] = vl.update(4, lineral({0,1,5}), 2);
+    CHECK( v == 6 );
+    CHECK( b );
+    CHECK( vl.insert(8, lineral({2,5}), 2).inserted );
+    CHECK( vl.to_str() == "(0,x1+x4) (6,x1+x5) (8,x2+x5)" );
+
+    CHECK( vl.get_occ(5) == vec<vert_t>({6,8}) );
+    vl.backtrack( std::move(r2), 1 );
+    CHECK( vl.to_str() == str1 );
+    CHECK( vl.get_occ(5) == vec<vert_t>({6}) );
+    CHECK( vl.contains(lineral({3,4})) );
+    CHECK( !vl.V_contains(lineral({2,5})) );
+
+    vl.backtrack( std::move(r1), 0 );
+    CHECK( vl.to_str() == str0 );
+    CHECK( vl.get_num_linerals() == n0 );
+    for(vert_t i = 0; i < lits.size(); ++i) CHECK( vl.at(2*i) == lits[i] );
+
+    //garbage collection at level 0 keeps labels only
+    vl.update(0, lineral({2,4}), 0);
+    vl.update(0, lineral({2,5}), 0);
+    vl.erase(6);
+    CHECK( vl.gc() == 3 );
+    CHECK( vl.get_num_linerals() == 4 );
+    CHECK( vl.to_str() == "(0,x2+x5) (2,x2+x3+1) (4,x3+x4)" );
+    CHECK( vl.V(lineral({0,3,4})) == SIGMA(4) );
+
+    //occurrence index is rebuilt from the labels
+    CHECK( vl.get_occ(1).empty() );
+    CHECK( vl.get_occ(5) == vec<vert_t>({0}) );
+    CHECK( vl.get_occ(3) == vec<vert_t>({2,4}) );
+
+    //copies are independent
+    vl_hcons vl_cpy(vl);
+    vl.erase(4);
+    CHECK( vl_cpy.at(4) == lineral({3,4}) );
+    CHECK( vl_cpy.at(lineral({2,5})) == 0 );
+}
@@ -118,10 +118,181 @@ TEST_CASE( "implication graph analysis - scc and to", "[graph][impl-graph][scc][
         CHECK( IG.to_str() == "(x1,x2); (x2+1,x1+1); (x2,x3); (x3+1,x2+1)\n0" );
 
         auto to = IG.get_TO();
-        CHECK( to == vec<var_t>({0,5,2,3,4,1}) ); //corr to: [x1, x3+1, x2, x2+1, x3, x1+1]
+        CHECK( to == vec<vert_t>({0,5,2,3,4,1}) ); //corr to: [x1, x3+1, x2, x2+1, x3, x1+1]
     }
 }
 
+TEST_CASE( "implication graph analysis - parallel scc", "[graph][impl-graph][scc]" ) {
+    vec< vec<lineral> > clss;
+    options opt(4);
+    opt.ext = constr::simple;
+
+    SECTION("two symmetrical comps") {
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,1})), lineral(vec<var_t>({2}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,2})), lineral(vec<var_t>({3}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,3})), lineral(vec<var_t>({1}))}) );
+    
+        impl_graph IG(clss, opt);
+        LinEqs L = IG.scc_analysis(0);
+        CHECK( L.to_str() == "x1+x3 x2+x3");
+        CHECK( L.is_consistent() );
+        CHECK( IG.get_no_v() == 2 );
+        CHECK( IG.assert_data_structs() );
+    }
+    
+    SECTION("a self-symmetrical comp") {
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,1})), lineral(vec<var_t>({2}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,2})), lineral(vec<var_t>({0,1}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({1})), lineral(vec<var_t>({0,3}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({3})), lineral(vec<var_t>({4}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,4})), lineral(vec<var_t>({1}))}) );
+    
+        impl_graph IG(clss, opt);
+        LinEqs L = IG.scc_analysis(0);
+        CHECK( L.dim() == 4 );
+        CHECK( !L.is_consistent() );
+    }
+
+    SECTION("2xnf instances") {
+        for(const auto& fname : {"test1.xnf", "test4.xnf", "test9.xnf", "test22.xnf", "flat30-100.xnf", "rand-20-60.xnf", "rand-40-80.xnf", "ToyExample-type1-n10-seed0.xnf", "ToyExample-type1-n15-seed2.xnf"}) {
+            auto clss = parse_file(xnf_path + "/" + fname);
+            impl_graph IG_seq(clss);
+            impl_graph IG_par(clss);
+            LinEqs L_seq = IG_seq.scc_analysis( IG_seq.get_no_v()+1 );
+            LinEqs L_par = IG_par.scc_analysis(0);
+            CHECK( L_seq.is_consistent() == L_par.is_consistent() );
+            if(!L_seq.is_consistent()) continue;
+            CHECK( L_seq.to_str() == L_par.to_str() );
+            CHECK( IG_seq.get_no_v() == IG_par.get_no_v() );
+            CHECK( IG_seq.get_no_e() == IG_par.get_no_e() );
+            CHECK( IG_par.assert_data_structs() );
+            //no more SCCs after merging
+            CHECK( IG_par.scc_analysis(0).size() == 0 );
+        }
+    }
+}
+
+TEST_CASE( "implication graph analysis - scc on long implication chains", "[graph][impl-graph][scc]" ) {
+    const var_t n = 20000;
+    options opt(n);
+    opt.ext = constr::simple;
+    //chain x1 -> x2 -> ... -> xn
+    vec< vec<lineral> > clss;
+    for(var_t i = 1; i < n; ++i) clss.push_back( vec<lineral>({lineral(vec<var_t>({0,i})), lineral(vec<var_t>({(var_t) (i+1)}))}) );
+
+    SECTION("chain") {
+        impl_graph IG(clss, opt);
+        CHECK( IG.scc_analysis(n+1).size() == 0 );
+        CHECK( IG.scc_analysis(0).size() == 0 );
+        CHECK( IG.get_no_v() == 2*n );
+    }
+
+    SECTION("cycle") {
+        //cycle x1 -> x2 -> ... -> xm -> x1 (shorter, as merging is expensive)
+        const var_t m = 2000;
+        clss.resize(m-1);
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,m})), lineral(vec<var_t>({1}))}) );
+        opt.num_vars = m;
+        impl_graph IG_seq(clss, opt);
+        impl_graph IG_par(clss, opt);
+        LinEqs L_seq = IG_seq.scc_analysis(m+1);
+        LinEqs L_par = IG_par.scc_analysis(0);
+        CHECK( L_seq.dim() == m-1 );
+        CHECK( L_seq.is_consistent() );
+        CHECK( L_seq.to_str() == L_par.to_str() );
+        CHECK( IG_seq.get_no_v() == 2 );
+        CHECK( IG_par.get_no_v() == 2 );
+    }
+}
+
+TEST_CASE( "implication graph - more vertices than 16-bit ids can address", "[graph][impl-graph]" ) {
+    //2*n > 2^16 vertices, only representable with VERT_T_BITS > 16
+    if(std::numeric_limits<vert_t>::max() <= 65535) return;
+    const var_t n = 40000;
+    options opt(n);
+    opt.ext = constr::simple;
+    vec< vec<lineral> > clss;
+    for(var_t i = 1; i < n; ++i) clss.push_back( vec<lineral>({lineral(vec<var_t>({0,i})), lineral(vec<var_t>({(var_t) (i+1)}))}) );
+
+    impl_graph IG(clss, opt);
+    CHECK( IG.get_no_v() == 2*n );
+    CHECK( IG.get_no_e() == 2*(n-1) );
+    CHECK( IG.scc_analysis(0).size() == 0 );
+    CHECK( IG.get_no_v() == 2*n );
+}
+
+
+TEST_CASE( "implication graph analysis - transitive reduction", "[graph][impl-graph][tr]" ) {
+    vec< vec<lineral> > clss;
+    options opt(4);
+    opt.ext = constr::simple;
+
+    SECTION("triangle") {
+        //x1+1 -> x2 -> x3 and x1+1 -> x3
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({1})), lineral(vec<var_t>({2}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,2})), lineral(vec<var_t>({3}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({1})), lineral(vec<var_t>({3}))}) );
+
+        impl_graph IG(clss, opt);
+        CHECK( IG.get_no_e() == 6 );
+        CHECK( IG.transitive_reduction() == 2 );
+        CHECK( IG.to_str() == "(x1+1,x2); (x2+1,x1); (x2,x3); (x3+1,x2+1)\n0" );
+        CHECK( IG.assert_data_structs() );
+        //already reduced
+        CHECK( IG.transitive_reduction() == 0 );
+    }
+
+    SECTION("2xnf instances") {
+        for(const auto& fname : {"test1.xnf", "test4.xnf", "test9.xnf", "flat30-100.xnf", "rand-20-60.xnf", "rand-40-80.xnf", "ToyExample-type1-n10-seed0.xnf"}) {
+            auto clss = parse_file(xnf_path + "/" + fname);
+            impl_graph IG(clss);
+            if(!IG.scc_analysis().is_consistent()) continue;
+            REQUIRE( IG.is_DAG() );
+            impl_graph IG_exact(IG);
+            impl_graph IG_approx(IG);
+            IG_exact.transitive_reduction();
+            //approximate reduction with tiny budget
+            IG_approx.transitive_reduction(0, 4);
+            CHECK( IG_exact.get_no_e() <= IG_approx.get_no_e() );
+            CHECK( IG_approx.get_no_e() <= IG.get_no_e() );
+            CHECK( IG_exact.assert_data_structs() );
+            CHECK( IG_approx.assert_data_structs() );
+            //reachability, and thus the implied linerals, are unchanged
+            const auto vs = IG.get_v_vector();
+            for(const auto v : vs) {
+                for(const auto w : vs) {
+                    CHECK( IG.is_descendant(v,w) == IG_exact.is_descendant(v,w) );
+                    CHECK( IG.is_descendant(v,w) == IG_approx.is_descendant(v,w) );
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE( "implication graph compaction", "[graph][impl-graph][compact]" ) {
+    for(const auto& fname : {"test1.xnf", "test4.xnf", "test9.xnf", "flat30-100.xnf", "rand-20-60.xnf", "rand-40-80.xnf", "ToyExample-type1-n10-seed0.xnf"}) {
+        auto clss = parse_file(xnf_path + "/" + fname);
+        impl_graph IG(clss);
+        //merge SCCs, s.t. some vertex ids become inactive
+        if(!IG.scc_analysis().is_consistent()) continue;
+        impl_graph IG_c(IG);
+        IG_c.compact();
+        CHECK( IG_c.get_no_v_total() == IG.get_no_v() );
+        CHECK( IG_c.get_no_v() == IG.get_no_v() );
+        CHECK( IG_c.get_no_e() == IG.get_no_e() );
+        CHECK( IG_c.assert_data_structs() );
+        //same edges on the same labels
+        CHECK( IG_c.to_str() == IG.to_str() );
+        CHECK( IG_c.is_DAG() == IG.is_DAG() );
+        //verts of SIGMA-pairs are adjacent
+        for(const auto v : IG_c.get_v_range()) CHECK( IG_c.get_color(SIGMA(v)) == SIGMA(v) );
+        //same solving result
+        stats s = IG.dpll_solve();
+        stats s_c = IG_c.dpll_solve();
+        CHECK( s.sat == s_c.sat );
+        if(s_c.sat) CHECK( check_sol(clss.cls, s_c.sol) );
+    }
+}
 
 TEST_CASE( "update implication graph", "[graph][impl-graph][update]" ) {
     //construct list of xor-clauses
@@ -571,6 +742,156 @@ TEST_CASE( "update-hf implication graph", "[graph][impl-graph][update-hf]" ) {
 }
 
 
+TEST_CASE( "update-par implication graph", "[graph][impl-graph][update-par]" ) {
+    //construct list of xor-clauses
+    vec< vec<lineral> > clss;
+    options opt(4);
+    
+    SECTION( "single clause update -- simple -- no new linerals"){
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,1})), lineral(vec<var_t>({2}))}) );
+        
+        //construct IG
+        opt.ext = constr::simple;
+        impl_graph IG(clss, opt);
+
+        CHECK( IG.to_str() == "(x1,x2); (x2+1,x1+1)\n0" );
+        
+        vec<lineral> linerals = { lineral(vec<var_t>({0,1}))};
+        LinEqs L = LinEqs( linerals );
+        
+        CHECK( L.to_str() == "x1+1" );
+
+        LinEqs L_new = IG.update_graph_par( L );
+
+        CHECK( L_new.to_str() == "0" );
+    }
+    
+    SECTION( "single clause update -- simple -- new linerals"){
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({0,1})), lineral(vec<var_t>({2}))}) );
+        
+        //construct IG
+        opt.ext = constr::simple;
+        impl_graph IG(clss, opt);
+
+        CHECK( IG.to_str() == "(x1,x2); (x2+1,x1+1)\n0" );
+        
+        vec<lineral> linerals = { lineral({1})};
+        LinEqs L = LinEqs( linerals );
+        IG.add_new_xsys(L);
+        
+        CHECK( L.to_str() == "x1" );
+
+        LinEqs L_new = IG.update_graph_par( L );
+
+        CHECK( L_new.to_str() == "x2" );
+    }
+    
+    SECTION( "single clause - new linerals"){
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({1})), lineral(vec<var_t>({2}))}) );
+        
+        //construct IG
+        impl_graph IG(clss, opt);
+
+        CHECK( IG.to_str() == "(x1+1,x1+x2+1) (x1+1,x2); (x1+x2,x1) (x1+x2,x2); (x2+1,x1) (x2+1,x1+x2+1)\n0" );
+        
+        vec<lineral> linerals = { lineral({1,2})};
+        LinEqs L = LinEqs( linerals );
+        IG.add_new_xsys(L);
+        
+        CHECK( L.to_str() == "x1+x2" );
+
+        LinEqs L_new = IG.update_graph_par( L );
+
+        CHECK( L_new.to_str() == "x2" );
+    }
+    
+    SECTION( "merging two clauses1"){
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({1})), lineral(vec<var_t>({2}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({3})), lineral(vec<var_t>({4}))}) );
+        
+        //construct IG
+        opt.ext = constr::simple;
+        impl_graph IG(clss, opt);
+
+        CHECK( IG.to_str() == "(x1+1,x2); (x2+1,x1); (x3+1,x4); (x4+1,x3)\n0" );
+        
+        vec<lineral> linerals = { lineral({1,3}), lineral({2,4})};
+        LinEqs L = LinEqs( linerals );
+        IG.add_new_xsys(L);
+        
+        CHECK( L.to_str() == "x1+x3 x2+x4" );
+
+        LinEqs L_new = IG.update_graph_par( L );
+
+        CHECK( L_new.to_str() == "0" );
+        
+        CHECK( IG.to_str() == "(x3+1,x4); (x4+1,x3)\n0\nx1+x3 x2+x4" );
+    }
+    
+    SECTION( "merging two clauses2"){
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({1})), lineral(vec<var_t>({2}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({3})), lineral(vec<var_t>({4}))}) );
+        
+        //construct IG
+        impl_graph IG(clss, opt);
+
+        CHECK( IG.to_str() == "(x1+1,x1+x2+1) (x1+1,x2); (x1+x2,x1) (x1+x2,x2); (x2+1,x1) (x2+1,x1+x2+1); (x3+1,x3+x4+1) (x3+1,x4); (x3+x4,x3) (x3+x4,x4); (x4+1,x3) (x4+1,x3+x4+1)\n0" );
+        
+        vec<lineral> xlits1 = { lineral(vec<var_t>({1,3}))};
+        LinEqs L1 = LinEqs( xlits1 );
+        IG.add_new_xsys(L1);
+        
+        CHECK( L1.to_str() == "x1+x3" );
+        
+        LinEqs L_new1 = IG.update_graph_par( L1 );
+
+        CHECK( L_new1.to_str() == "0" );
+
+        CHECK( IG.to_str() == "(x2+1,x2+x3+1) (x2+1,x3); (x2+x3,x2) (x2+x3,x3); (x3+1,x2) (x3+1,x2+x3+1) (x3+1,x3+x4+1) (x3+1,x4); (x3+x4,x3) (x3+x4,x4); (x4+1,x3) (x4+1,x3+x4+1)\n0\nx1+x3" );
+        //CHECK( IG.to_str() == "(x2+1,x2+x3+1) (x2+1,x3); (x2+x3,x2) (x2+x3,x3); (x3+1,x2) (x3+1,x2+x3+1) (x3+1,x3+x4+1) (x3+1,x4); (x4+1,x3) (x4+1,x3+x4+1); (x3+x4,x3) (x3+x4,x4)\n0" );
+        
+        vec<lineral> xlits2 = {lineral(vec<var_t>({2,4}))};
+        LinEqs L2 = LinEqs( xlits2 );
+        IG.add_new_xsys(L2);
+        
+        CHECK( L2.to_str() == "x2+x4" );
+        
+        LinEqs L_new2 = IG.update_graph_par( L2 );
+
+        CHECK( L_new1.to_str() == "0" );
+        
+        CHECK( IG.to_str() == "(x3+1,x3+x4+1) (x3+1,x4); (x3+x4,x3) (x3+x4,x4); (x4+1,x3) (x4+1,x3+x4+1)\n0\nx1+x3\nx2+x4" );
+    }
+    
+    SECTION( "merging three clauses"){
+        opt.num_vars = 6;
+
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({1})), lineral(vec<var_t>({2}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({3})), lineral(vec<var_t>({4}))}) );
+        clss.push_back( vec<lineral>({lineral(vec<var_t>({5})), lineral(vec<var_t>({6}))}) );
+        
+        //construct IG
+        opt.ext = constr::simple;
+        impl_graph IG(clss, opt);
+
+        CHECK( IG.to_str() == "(x1+1,x2); (x2+1,x1); (x3+1,x4); (x4+1,x3); (x5+1,x6); (x6+1,x5)\n0" );
+        
+        vec<lineral> linerals = { lineral(vec<var_t>({1,3})), lineral(vec<var_t>({1,5}))};
+        LinEqs L = LinEqs( linerals );
+        IG.add_new_xsys(L);
+        
+        CHECK( L.to_str() == "x1+x5 x3+x5" );
+
+        LinEqs L_new = IG.update_graph_par( L );
+
+        CHECK( L_new.to_str() == "0" );
+        
+        CHECK( IG.to_str() == "(x2+1,x5); (x4+1,x5); (x5+1,x2) (x5+1,x4) (x5+1,x6); (x6+1,x5)\n0\nx1+x5 x3+x5" );
+        //CHECK( IG.to_str() == "(x2+1,x5); (x4+1,x5); (x5+1,x2) (x5+1,x4) (x5+1,x6); (x6+1,x5)\n0" );
+    }
+}
+
+
 TEST_CASE( "parsing and solving instances/2xnfs test instances" , "[impl-graph][graph][parser][scc]" ) {
     SECTION( "test0.xnf" ) {
         auto clss = parse_file(xnf_path + "/test0.xnf");
@@ -31,7 +31,7 @@ TEST_CASE( "solving all test xnfs" , "[impl-graph][parser][solve]" ) {
     auto clss = parse_file( fname );
     auto xnf = clss.cls;
     var_t num_vars = clss.num_vars;
-    var_t num_cls = clss.num_cls;
+    edge_cnt_t num_cls = clss.num_cls;
 
     SECTION( "dh:mbn-fls:no" ) {
         options opts(num_vars, num_cls, dec_heu::mbn, fls_alg::no, upd_alg::ts, 0, 0);
@@ -52,7 +52,7 @@ TEST_CASE( "solving with different options" , "[impl-graph][graph][parser][solve
     auto clss = parse_file( fname );
     auto xnf = clss.cls;
     var_t num_vars = clss.num_vars;
-    var_t num_cls = clss.num_cls;
+    edge_cnt_t num_cls = clss.num_cls;
 
     SECTION( "dh:fv-fls:no-upd:ts" ) {
         options opts(num_vars, num_cls, dec_heu::fv, fls_alg::no, upd_alg::ts, 0, 0);
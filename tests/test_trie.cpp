@@ -30,13 +30,13 @@ TEST_CASE( "trie creation, insert", "[trie]" ) {
     vl_trie tr = vl_trie(4,4);
 
     lineral l1 = lineral({0,1,2,3});
-    var_t v1 = 0;
+    vert_t v1 = 0;
 
     lineral l2 = lineral({2,3});
-    var_t v2 = 1;
+    vert_t v2 = 1;
     
     lineral l3 = lineral({0,1,2});
-    var_t v3 = 2;
+    vert_t v3 = 2;
 
     auto ins1 = tr.insert(v1, l1, 0);
     CHECK( tr.size()==1 );
@@ -103,7 +103,7 @@ TEST_CASE( "trie creation, insert", "[trie]" ) {
     }
     
     {
-        var_t n = 3;
+        vert_t n = 3;
         auto ins_fail2 = tr.insert(n, l1, 0);
 
         CHECK( !ins_fail2.inserted );
@@ -135,11 +135,11 @@ TEST_CASE( "trie creation, insert", "[trie]" ) {
 TEST_CASE( "trie update/erase/insert", "[trie]" ) {
     vl_trie tr = vl_trie(4,4);
     lineral f = lineral({2,3,4});
-    var_t vf = 0;
+    vert_t vf = 0;
     lineral g = lineral({1,3,4});
-    var_t vg = 1;
+    vert_t vg = 1;
     lineral h = lineral({1,3});
-    var_t vh = 2;
+    vert_t vh = 2;
     
     auto ins1 = tr.insert(vf, f, 0);
     CHECK( tr.size()==1 );
@@ -183,6 +183,192 @@ TEST_CASE( "trie update/erase/insert", "[trie]" ) {
     CHECK( tr.to_str() == "(2,x1+x3)" );
 }
 
+TEST_CASE( "trie with many children per node", "[trie]" ) {
+    const var_t n = 40;
+    vl_trie tr = vl_trie(n);
+    //labels x1+xn, ..., x(n-1)+xn all share node xn; insert them in non-sorted order
+    vert_t v = 0;
+    for(var_t i = 1; i < n; i += 2) tr.insert(2*(v++), lineral({i,n}), 0);
+    const auto st = tr.get_state();
+    for(var_t i = 2; i < n; i += 2) tr.insert(2*(v++), lineral({i,n}), 1);
+    CHECK( tr.size()==n-1 );
+    CHECK( tr.get_num_nodes()==n+1 );
+    for(var_t i = 1; i < n; ++i) {
+        CHECK( tr.contains(lineral({i,n})) );
+        CHECK( tr.contains(lineral({0,i,n})) == false );
+        CHECK( tr.V(lineral({0,i,n})) == SIGMA(tr.at(lineral({i,n}))) );
+    }
+    CHECK( tr.sum(0, 2) == lineral({1,3}) );
+
+    //backtracking removes the children added in level 1 only
+    tr.backtrack(trie_repr(st), 0);
+    CHECK( tr.size()==n/2 );
+    CHECK( tr.get_num_nodes()==n/2+2 );
+    for(var_t i = 1; i < n; ++i) CHECK( tr.contains(lineral({i,n})) == (i%2==1) );
+
+    //copies are deep
+    vl_trie tr_cpy(tr);
+    tr_cpy.insert(2*v, lineral({2,n}), 0);
+    CHECK( tr_cpy.contains(lineral({2,n})) );
+    CHECK( !tr.contains(lineral({2,n})) );
+}
+
+TEST_CASE( "trie garbage collection", "[trie]" ) {
+    vl_trie tr = vl_trie(4,4);
+    tr.insert(0, lineral({2,3,4}), 0);
+    tr.insert(1, lineral({1,3,4}), 0);
+    tr.insert(2, lineral({1,3}), 0);
+    CHECK( tr.get_num_nodes()==7 );
+
+    tr.update(0, lineral({1,2}), 0);
+    CHECK( tr.get_num_nodes()==9 );
+    CHECK( !tr.gc_due() );
+
+    tr.erase(2);
+    tr.update(1, lineral({0,3,4}), 0);
+    CHECK( tr.gc_due() );
+    const std::string s = tr.to_str();
+    CHECK( s == "(0,x1+x2) (1,x3+x4+1)" );
+
+    //nodes of erased labels are only dropped by gc
+    CHECK( tr.get_num_nodes()==10 );
+    CHECK( tr.gc()==4 );
+    CHECK( tr.get_num_nodes()==6 );
+    CHECK( !tr.gc_due() );
+    CHECK( tr.to_str() == s );
+
+    //trie is still functional
+    CHECK( tr.at(lineral({1,2}))==0 );
+    CHECK( tr.V(lineral({3,4}))==SIGMA(1) );
+    auto ins = tr.insert(3, lineral({1,2}), 0);
+    CHECK( !ins.inserted );
+    CHECK( ins.vert==0 );
+    auto ins2 = tr.insert(3, lineral({1,3}), 0);
+    CHECK( ins2.inserted );
+    CHECK( tr.to_str() == "(0,x1+x2) (1,x3+x4+1) (3,x1+x3)" );
+}
+
+TEST_CASE( "trie backtracking over multiple levels", "[trie]" ) {
+    vl_trie tr = vl_trie(4,4);
+    tr.insert(0, lineral({1,2}), 0);
+    tr.insert(1, lineral({2,3}), 0);
+    const std::string s0 = tr.to_str();
+    const auto st0 = tr.get_state();
+
+    //level 1: update, erase and insert
+    tr.update(0, lineral({1,4}), 1);
+    tr.erase(1);
+    tr.insert(2, lineral({3,4}), 1);
+    const std::string s1 = tr.to_str();
+    CHECK( s1 == "(0,x1+x4) (2,x3+x4)" );
+    const auto st1 = tr.get_state();
+
+    //level 2: update the same vertex twice, re-insert erased vertex with different label
+    tr.update(0, lineral({2,4}), 2);
+    tr.update(0, lineral({1,3}), 2);
+    tr.insert(1, lineral({1,2,3}), 2);
+    tr.erase(2);
+    CHECK( tr.to_str() == "(0,x1+x3) (1,x1+x2+x3)" );
+
+    tr.backtrack(trie_repr(st1), 1);
+    CHECK( tr.size()==2 );
+    CHECK( tr.to_str() == s1 );
+    CHECK( tr.at(lineral({1,4}))==0 );
+    CHECK( !tr.contains(lineral({1,3})) );
+
+    //redo level 2, then backtrack directly to level 0
+    tr.update(2, lineral({1,2,4}), 2);
+    tr.backtrack(trie_repr(st0), 0);
+    CHECK( tr.size()==2 );
+    CHECK( tr.to_str() == s0 );
+    CHECK( tr.at(lineral({2,3}))==1 );
+    CHECK( !tr.contains(lineral({3,4})) );
+    CHECK( !tr.contains(2) );
+
+    //changes after backtracking to level 0 are kept
+    tr.update(1, lineral({2,4}), 0);
+    const auto st0_ = tr.get_state();
+    tr.insert(2, lineral({3}), 1);
+    tr.backtrack(trie_repr(st0_), 0);
+    CHECK( tr.to_str() == "(0,x1+x2) (1,x2+x4)" );
+}
+
+TEST_CASE( "trie label cache", "[trie]" ) {
+    vl_trie tr = vl_trie(4,5);
+    tr.insert(0, lineral({0,1,2}), 0);
+    tr.insert(2, lineral({2,3}), 0);
+    tr.insert(4, lineral({1,4,5}), 0);
+    const auto st0 = tr.get_state();
+
+    //repeated reads (and sums) are served from the cache
+    for(int i = 0; i < 2; ++i) {
+        CHECK( tr.at(0) == lineral({0,1,2}) );
+        CHECK( tr.Vxlit(SIGMA(2)) == lineral({0,2,3}) );
+        CHECK( tr.sum(0, 2) == lineral({0,1,3}) );
+        CHECK( tr.sum(2, 4) == lineral({1,2,3,4,5}) );
+    }
+
+    //updates and erasures invalidate the cached label
+    tr.update(0, lineral({1,3}), 1);
+    CHECK( tr.at(0) == lineral({1,3}) );
+    CHECK( tr.sum(0, 2) == lineral({1,2}) );
+    tr.erase(2);
+    CHECK_THROWS( tr.at(2) );
+    tr.insert(2, lineral({0,4}), 1);
+    CHECK( tr.at(2) == lineral({0,4}) );
+
+    //backtracking clears the cache
+    tr.backtrack(trie_repr(st0), 0);
+    CHECK( tr.at(0) == lineral({0,1,2}) );
+    CHECK( tr.at(2) == lineral({2,3}) );
+    CHECK( tr.sum(0, 4) == lineral({0,2,4,5}) );
+
+    //copies keep their cached labels
+    vl_trie tr_cpy(tr);
+    tr.update(4, lineral({5}), 0);
+    CHECK( tr_cpy.at(4) == lineral({1,4,5}) );
+    CHECK( tr.at(4) == lineral({5}) );
+}
+
+TEST_CASE( "trie occurrence index", "[trie]" ) {
+    vl_trie tr = vl_trie(4,5);
+    tr.insert(0, lineral({1,2}), 0);
+    tr.insert(2, lineral({0,2,3}), 0);
+    tr.insert(4, lineral({3,4}), 0);
+    CHECK( tr.get_occ(1) == vec<vert_t>({0}) );
+    CHECK( tr.get_occ(2) == vec<vert_t>({0,2}) );
+    CHECK( tr.get_occ(3) == vec<vert_t>({2,4}) );
+    CHECK( tr.get_occ(5).empty() );
+    const auto st0 = tr.get_state();
+
+    //new labels are added, old entries are kept
+    tr.update(0, lineral({1,5}), 1);
+    tr.erase(4);
+    CHECK( tr.get_occ(5) == vec<vert_t>({0}) );
+    CHECK( tr.get_occ(2) == vec<vert_t>({0,2}) );
+    CHECK( tr.get_occ(3) == vec<vert_t>({2,4}) );
+    const auto st1 = tr.get_state();
+    tr.insert(4, lineral({2,5}), 2);
+    CHECK( tr.get_occ(2) == vec<vert_t>({0,2,4}) );
+    CHECK( tr.get_occ(5) == vec<vert_t>({0,4}) );
+
+    //backtracking removes entries of labels of higher levels
+    tr.backtrack(trie_repr(st1), 1);
+    CHECK( tr.get_occ(2) == vec<vert_t>({0,2}) );
+    CHECK( tr.get_occ(5) == vec<vert_t>({0}) );
+    tr.backtrack(trie_repr(st0), 0);
+    CHECK( tr.get_occ(5).empty() );
+    CHECK( tr.get_occ(1) == vec<vert_t>({0}) );
+
+    //gc rebuilds the index from the current labels
+    tr.update(0, lineral({4,5}), 0);
+    tr.gc();
+    CHECK( tr.get_occ(1).empty() );
+    vec<vert_t> occ4 = tr.get_occ(4);
+    std::sort(occ4.begin(), occ4.end());
+    CHECK( occ4 == vec<vert_t>({0,4}) );
+}
+
 /*
 TEST_CASE( "trie impl graph test", "[trie]" ) {
     //auto clss = parse_file("../../benchmarks/instances/2xnfs/rand/rand-10-20_2.xnf");
@@ -256,11 +442,11 @@ TEST_CASE( "trie copy ctor", "[trie]" ) {
 TEST_CASE( "trie iterator", "[trie]") {
     vl_trie tr = vl_trie(4,4);
     lineral f = lineral({2,3,4});
-    var_t vf = 0;
+    vert_t vf = 0;
     lineral g = lineral({1,3,4});
-    var_t vg = 1;
+    vert_t vg = 1;
     lineral h = lineral({1,3});
-    var_t vh = 2;
+    vert_t vh = 2;
     
     auto ins1 = tr.insert(vf, f, 0);
     auto ins2 = tr.insert(vg, g, 0);